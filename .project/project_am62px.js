@@ -8,12 +8,16 @@ const files_r5f={
         "safety_checkers_pm.c",
 		"safety_checkers_rm.c",
         "safety_checkers_tifs.c",
+        "safety_checkers_common.c",
+        "safety_checkers_golden.c",
+        "safety_checkers_verify_soc.c",
     ],
 };
 
 const filedirs = {
     common: [
 		"${MCU_PLUS_SDK_PATH}/source/safety_checkers/src",
+		"${MCU_PLUS_SDK_PATH}/source/safety_checkers/src/soc/am62px",
     ],
 };
 
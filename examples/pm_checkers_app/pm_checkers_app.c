@@ -51,7 +51,11 @@
 /*                           Macros & Typedefs                                */
 /* ========================================================================== */
 
-/* None */
+/* PLL reference clock (HFOSC0) of the supported boards */
+#define SAFETY_CHECKERS_APP_PLL_REF_FREQ_HZ       (25000000U)
+/* Operating range of the PLL_16FFT VCO */
+#define SAFETY_CHECKERS_APP_PLL_VCO_MIN_HZ        (800000000U)
+#define SAFETY_CHECKERS_APP_PLL_VCO_MAX_HZ        (3200000000U)
 
 /* ========================================================================== */
 /*                         Structure Declarations                             */
@@ -86,6 +90,7 @@ static int32_t SafetyCheckersApp_pmParentClkCheck(uint32_t offset);
 static int32_t SafetyCheckersApp_pmPllLockVerify(int32_t deviceID);
 static int32_t SafetyCheckersApp_pmRegCfgVerify(int32_t deviceID);
 static int32_t SafetyCheckersApp_pmErrCheck(void);
+static int32_t SafetyCheckersApp_pmPllFreqCheck(void);
 static int32_t SafetyCheckersApp_pmPerfTest(void);
 
 /* ========================================================================== */
@@ -142,6 +147,11 @@ void SafetyCheckersApp_pmRun(void *arg0)
         status = SafetyCheckersApp_pmErrCheck();
     }
 
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        status = SafetyCheckersApp_pmPllFreqCheck();
+    }
+
     if(SAFETY_CHECKERS_SOK == status)
     {
         SAFETY_CHECKERS_log("\n*****  Starting negative test cases  *****\r\n");
@@ -773,6 +783,66 @@ static int32_t SafetyCheckersApp_pmErrCheck(void)
     return (status);
 }
 
+static int32_t SafetyCheckersApp_pmPllFreqCheck(void)
+{
+    int32_t      status = SAFETY_CHECKERS_SOK;
+    int32_t      decodeStatus;
+    uint32_t     pll;
+    uint32_t     numVerified = 0U;
+    uintptr_t    pllRegisterData[SAFETY_CHECKERS_PM_PLL_REGDUMP_SIZE];
+    SafetyCheckers_PmPllFreq pllFreq;
+    SafetyCheckers_PmPllFreqRange freqRange;
+
+    /* Get the PLL register dump, the frequencies are decoded from it without TISCI requests */
+    status = SafetyCheckers_pmGetPllRegCfg (pllRegisterData, SAFETY_CHECKERS_PM_PLL_REGDUMP_SIZE);
+
+    for (pll = 0U; (SAFETY_CHECKERS_SOK == status) && (pll < SafetyCheckers_pmGetNumPll()); pll++)
+    {
+        decodeStatus = SafetyCheckers_pmDecodePllFreq (pll, pllRegisterData, SAFETY_CHECKERS_PM_PLL_REGDUMP_SIZE,
+                                                       SAFETY_CHECKERS_APP_PLL_REF_FREQ_HZ, &pllFreq);
+        if((SAFETY_CHECKERS_SOK == decodeStatus) && (pllFreq.locked != 0U))
+        {
+            SAFETY_CHECKERS_log("\nPLL %d: VCO %d MHz, POSTDIV %d MHz, HSDIV0 %d MHz\r\n", pll,
+                                (uint32_t)(pllFreq.vcoFreqHz / 1000000U), (uint32_t)(pllFreq.postDivFreqHz / 1000000U),
+                                (uint32_t)(pllFreq.hsdivFreqHz[0] / 1000000U));
+
+            /* A locked PLL has to run its VCO inside the PLL_16FFT operating range */
+            freqRange.pll = pll;
+            freqRange.refFreqHz = SAFETY_CHECKERS_APP_PLL_REF_FREQ_HZ;
+            freqRange.output = SAFETY_CHECKERS_PM_PLL_OUT_VCO;
+            freqRange.minFreqHz = SAFETY_CHECKERS_APP_PLL_VCO_MIN_HZ;
+            freqRange.maxFreqHz = SAFETY_CHECKERS_APP_PLL_VCO_MAX_HZ;
+            status = SafetyCheckers_pmVerifyPllFreq (pllRegisterData, SAFETY_CHECKERS_PM_PLL_REGDUMP_SIZE,
+                                                     &freqRange, 1U);
+
+            /* A range that excludes the decoded VCO frequency has to be reported */
+            if(SAFETY_CHECKERS_SOK == status)
+            {
+                freqRange.minFreqHz = pllFreq.vcoFreqHz + 1U;
+                freqRange.maxFreqHz = pllFreq.vcoFreqHz + 1U;
+                if(SAFETY_CHECKERS_REG_DATA_MISMATCH != SafetyCheckers_pmVerifyPllFreq (pllRegisterData,
+                                                          SAFETY_CHECKERS_PM_PLL_REGDUMP_SIZE, &freqRange, 1U))
+                {
+                    status = SAFETY_CHECKERS_FAIL;
+                }
+            }
+            numVerified++;
+        }
+    }
+
+    if((SAFETY_CHECKERS_SOK == status) && (numVerified != 0U))
+    {
+        SAFETY_CHECKERS_log("\nPLL frequency range test passed\r\n\n");
+    }
+    else
+    {
+        SAFETY_CHECKERS_log("\nError: PLL frequency range test failed !!!\r\n\n");
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    return (status);
+}
+
 static int32_t SafetyCheckersApp_pmPerfTest(void)
 {
     int32_t      status = SAFETY_CHECKERS_FAIL;
@@ -828,6 +898,28 @@ static int32_t SafetyCheckersApp_pmPerfTest(void)
         }
     }
 
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        startTime = SafetyCheckersApp_getTimeUsec();
+
+        /* validate both register dumps with the generated straight-line routines */
+        status = SafetyCheckers_pmVerifyPscRegCfgUnrolled (pscRegisterData, SAFETY_CHECKERS_PM_PSC_REGDUMP_SIZE);
+        if(SAFETY_CHECKERS_SOK == status)
+        {
+            status = SafetyCheckers_pmVerifyPllRegCfgUnrolled (pllRegisterData, SAFETY_CHECKERS_PM_PLL_REGDUMP_SIZE);
+        }
+
+        endTime = SafetyCheckersApp_getTimeUsec();
+        if (endTime < startTime)
+        {
+            /* Counter overflow occured */
+            timeDiff = (0xFFFFFFFFU - startTime) + endTime + 1U;
+        }
+        timeDiff = endTime - startTime;
+
+        SAFETY_CHECKERS_log("\nTime taken for the execution of unrolled PSC and PLL readback : %d usecs\r\n", timeDiff);
+    }
+
     if(SAFETY_CHECKERS_SOK == status)
     {
         startTime = SafetyCheckersApp_getTimeUsec();
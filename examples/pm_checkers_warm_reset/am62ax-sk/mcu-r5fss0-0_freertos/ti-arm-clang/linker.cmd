@@ -95,6 +95,10 @@ SECTIONS
         .fini_array: {} palign(8)   /* Contains function pointers called after main */
     } > MSRAM
 
+    /* Reset retained golden image. Not part of the loaded image and not cleared by the
+     * startup code, so it survives the MCU warm reset
+     */
+    .TI.noinit: {} palign(8) > MSRAM_GOLDEN_RETAIN, type = NOINIT
 }
 
 MEMORY
@@ -103,6 +107,8 @@ MEMORY
     R5F_TCMA  : ORIGIN = 0x00000040 , LENGTH = 0x00007FC0
     R5F_TCMB  : ORIGIN = 0x41010000 , LENGTH = 0x00008000
 
-    MSRAM     : ORIGIN = 0x79100000 , LENGTH = 0x80000
+    MSRAM     : ORIGIN = 0x79100000 , LENGTH = 0x78000
+    /* Reset retained golden image, outside of the loaded image [ size 32 KB ] */
+    MSRAM_GOLDEN_RETAIN : ORIGIN = 0x79178000 , LENGTH = 0x8000
 
 }
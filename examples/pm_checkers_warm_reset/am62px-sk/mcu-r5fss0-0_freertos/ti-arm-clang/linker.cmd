@@ -95,6 +95,10 @@ SECTIONS
         .fini_array: {} palign(8)   /* Contains function pointers called after main */
     } > MSRAM
 
+    /* Reset retained golden image. Not part of the loaded image and not cleared by the
+     * startup code, so it survives the MCU warm reset
+     */
+    .TI.noinit: {} palign(8) > DDR_GOLDEN_RETAIN, type = NOINIT
 }
 
 MEMORY
@@ -105,5 +109,6 @@ MEMORY
 
     MSRAM     : ORIGIN = 0x79100000 , LENGTH = 0x80000
 
-    DDR_CODE_DATA                 : ORIGIN = 0x9BA00000, LENGTH = 0xE00000   /* Code/Data            */
+    DDR_CODE_DATA                 : ORIGIN = 0x9BA00000, LENGTH = 0xDF8000   /* Code/Data            */
+    DDR_GOLDEN_RETAIN             : ORIGIN = 0x9C7F8000, LENGTH = 0x8000     /* Reset retained golden image */
 }
@@ -151,6 +151,10 @@ SECTIONS
         .fini_array: {} palign(8)   /* Contains function pointers called after main */
     } > DDR
 
+    /* Reset retained golden image. Not part of the loaded image and not cleared by the
+     * startup code, so it survives the MCU warm reset
+     */
+    .TI.noinit: {} palign(8) > DDR_GOLDEN_RETAIN, type = NOINIT
 }
 
 MEMORY
@@ -165,6 +169,8 @@ MEMORY
 
     /* DDR for FS Stub binary [ size 32.00 KB ] */
     DDR_FS_STUB    (RWIX)      : ORIGIN = 0x9DC00000 LENGTH = 0x00008000
-    /* DDR for DM R5F code/data [ size 10 MB + 992 KB ] */
-    DDR            (RWIX)      : ORIGIN = 0x9DC08000 LENGTH = 0x00AF8000
+    /* DDR for DM R5F code/data [ size 10 MB + 960 KB ] */
+    DDR            (RWIX)      : ORIGIN = 0x9DC08000 LENGTH = 0x00AF0000
+    /* DDR for the reset retained golden image [ size 32 KB ] */
+    DDR_GOLDEN_RETAIN (RWIX)   : ORIGIN = 0x9E6F8000 LENGTH = 0x00008000
 }
@@ -94,6 +94,11 @@ SECTIONS
         .init_array: {} palign(8)   /* Contains function pointers called before main */
         .fini_array: {} palign(8)   /* Contains function pointers called after main */
     } > DDR_CODE_DATA
+
+    /* Reset retained golden image. Not part of the loaded image and not cleared by the
+     * startup code, so it survives the MCU warm reset
+     */
+    .TI.noinit: {} palign(8) > DDR_GOLDEN_RETAIN, type = NOINIT
 }
 
 MEMORY
@@ -102,5 +107,6 @@ MEMORY
     R5F_TCMA  : ORIGIN = 0x00000040 , LENGTH = 0x00007FC0
     R5F_TCMB0 : ORIGIN = 0x41010000 , LENGTH = 0x00004000
 
-    DDR_CODE_DATA                 : ORIGIN = 0xA2200000, LENGTH = 0xE00000   /* Code/Data            */
+    DDR_CODE_DATA                 : ORIGIN = 0xA2200000, LENGTH = 0xDF8000   /* Code/Data            */
+    DDR_GOLDEN_RETAIN             : ORIGIN = 0xA2FF8000, LENGTH = 0x8000     /* Reset retained golden image */
 }
@@ -106,6 +106,11 @@ SECTIONS
         .init_array: {} palign(8)   /* Contains function pointers called before main */
         .fini_array: {} palign(8)   /* Contains function pointers called after main */
     } > DDR
+
+    /* Reset retained golden image. Not part of the loaded image and not cleared by the
+     * startup code, so it survives the MCU warm reset
+     */
+    .TI.noinit: {} palign(8) > DDR_GOLDEN_RETAIN, type = NOINIT
 }
 
 MEMORY
@@ -115,7 +120,9 @@ MEMORY
     R5F_TCMB_VEC   (RWIX)      : ORIGIN = 0x41010000 LENGTH = 0x00000040
     R5F_TCMB       (RWIX)      : ORIGIN = 0x41010040 LENGTH = 0x00007FC0
 
-    /* DDR for DM R5F code/data [ size 29 MiB ] */
-    DDR       : ORIGIN = 0xA0200000 LENGTH = 0xE00000
+    /* DDR for DM R5F code/data [ size 14 MiB - 32 KiB ] */
+    DDR       : ORIGIN = 0xA0200000 LENGTH = 0xDF8000
+    /* DDR for the reset retained golden image [ size 32 KiB ] */
+    DDR_GOLDEN_RETAIN : ORIGIN = 0xA0FF8000 LENGTH = 0x8000
 
 }
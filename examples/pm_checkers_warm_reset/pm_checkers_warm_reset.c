@@ -44,12 +44,22 @@
 
 #include <sciclient.h>
 #include <safety_checkers_common.h>
+#include <safety_checkers_soc.h>
+#include <safety_checkers_golden.h>
 
 /* ========================================================================== */
 /*                           Macros & Typedefs                                */
 /* ========================================================================== */
 
-/* None */
+/** \brief Golden image directory entries, one per PSC domain, PLL and RM module */
+#define SAFETY_CHECKERS_APP_GOLDEN_MAX_SECTIONS      (128U)
+/** \brief Size of the reset retained golden image region in 32-bit words */
+#define SAFETY_CHECKERS_APP_GOLDEN_RETAIN_SIZE       (SAFETY_CHECKERS_GOLDEN_RETAIN_HDR_WORDS + \
+                                                      SAFETY_CHECKERS_GOLDEN_HDR_WORDS + \
+                                                      (SAFETY_CHECKERS_APP_GOLDEN_MAX_SECTIONS * SAFETY_CHECKERS_GOLDEN_SEC_WORDS) + \
+                                                      SAFETY_CHECKERS_GOLDEN_SIZE)
+/** \brief Application defined core id stored in the golden image */
+#define SAFETY_CHECKERS_APP_GOLDEN_CORE_ID           (0U)
 
 /* ========================================================================== */
 /*                         Structure Declarations                             */
@@ -61,13 +71,16 @@
 /*                          Function Declarations                             */
 /* ========================================================================== */
 
-/* None */
+static int32_t SafetyCheckersApp_pmWarmResetGolden(void);
+static int32_t SafetyCheckersApp_pmWarmResetCapture(uint32_t *region, const uint32_t **goldenImage);
+static int32_t SafetyCheckersApp_pmWarmResetRecapture(void);
 
 /* ========================================================================== */
 /*                            Global Variables                                */
 /* ========================================================================== */
 
-/* None */
+/* Not initialized by the startup code so the golden image survives the MCU warm reset */
+__attribute__((section(".TI.noinit"))) uint64_t gSafetyCheckersAppGoldenRetain[(SAFETY_CHECKERS_APP_GOLDEN_RETAIN_SIZE + 1U) / 2U];
 
 /* ========================================================================== */
 /*                          Function Definitions                              */
@@ -81,16 +94,25 @@ int32_t SafetyCheckersApp_pmWarmResetRun(void *arg0)
 
     uint32_t mmrResetRegister = (*((volatile uint32_t *)(CSL_WKUP_CTRL_MMR0_CFG0_BASE + SAFETY_CHECKERS_PM_WKUP_CTRL_MMR_CFG0_RESET_SRC_STAT)));
 
-    if((mmrResetRegister & SAFETY_CHECKERS_PM_WARM_RESET_MASK) == SAFETY_CHECKERS_PM_WARM_RESET_MASK)
+    /* Reuses the retained golden image after a warm reset, captures it after POR */
+    status = SafetyCheckersApp_pmWarmResetGolden();
+
+    if((SAFETY_CHECKERS_SOK == status) &&
+       ((mmrResetRegister & SAFETY_CHECKERS_PM_WARM_RESET_MASK) == SAFETY_CHECKERS_PM_WARM_RESET_MASK))
     {
         /* Software MCU warm reset is occurred */
         SAFETY_CHECKERS_log("MCU reset occured due to warm reset\r\n");
+        status = SafetyCheckersApp_pmWarmResetRecapture();
     }
-    else
+    else if(SAFETY_CHECKERS_SOK == status)
     {
         SAFETY_CHECKERS_log("Doing MCU warm reset reset as it is encountered from POR\r\n");
         status = Sciclient_pmDeviceReset(0xFFFFFFFFU);
     }
+    else
+    {
+        /* Golden image capture or verify failed */
+    }
 
     if(SAFETY_CHECKERS_SOK != status)
     {
@@ -109,3 +131,119 @@ int32_t SafetyCheckersApp_pmWarmResetRun(void *arg0)
 
     return status;
 }
+
+/* ========================================================================== */
+/*                       Internal Function Definitions                        */
+/* ========================================================================== */
+
+static int32_t SafetyCheckersApp_pmWarmResetGolden(void)
+{
+    int32_t         status = SAFETY_CHECKERS_SOK;
+    uint32_t       *region = (uint32_t *)gSafetyCheckersAppGoldenRetain;
+    const uint32_t *goldenImage = NULL;
+    uint32_t        bootCount = 0U;
+    uint32_t        verifyMask = SAFETY_CHECKERS_GOLDEN_SEC_TYPE_MASK(SAFETY_CHECKERS_GOLDEN_SEC_TYPE_PSC) |
+                                 SAFETY_CHECKERS_GOLDEN_SEC_TYPE_MASK(SAFETY_CHECKERS_GOLDEN_SEC_TYPE_PLL) |
+                                 SAFETY_CHECKERS_GOLDEN_SEC_TYPE_MASK(SAFETY_CHECKERS_GOLDEN_SEC_TYPE_RM);
+
+    status = SafetyCheckers_goldenRetainRestore(region, SAFETY_CHECKERS_APP_GOLDEN_RETAIN_SIZE,
+                                                &goldenImage, &bootCount);
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        SAFETY_CHECKERS_log("Retained golden image reused, warm boot %d\r\n", bootCount);
+    }
+    else if(SAFETY_CHECKERS_REG_DATA_MISMATCH == status)
+    {
+        /* The image captured at POR did not survive the warm reset, never re-baseline it from live registers */
+        SAFETY_CHECKERS_log("Retained golden image corrupted across the warm reset\r\n");
+    }
+    else
+    {
+        /* POR or no sealed region: capture the golden image in the retained region */
+        status = SafetyCheckersApp_pmWarmResetCapture(region, &goldenImage);
+    }
+
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        status = SafetyCheckers_goldenVerify(goldenImage, verifyMask);
+    }
+
+    if(SAFETY_CHECKERS_SOK != status)
+    {
+        SAFETY_CHECKERS_log("Golden image verify failed\r\n");
+    }
+
+    return status;
+}
+
+static int32_t SafetyCheckersApp_pmWarmResetCapture(uint32_t *region, const uint32_t **goldenImage)
+{
+    int32_t   status = SAFETY_CHECKERS_SOK;
+    uint32_t *image = &region[SAFETY_CHECKERS_GOLDEN_RETAIN_HDR_WORDS];
+
+    status = SafetyCheckers_goldenInit(image, SAFETY_CHECKERS_APP_GOLDEN_RETAIN_SIZE - SAFETY_CHECKERS_GOLDEN_RETAIN_HDR_WORDS,
+                                       SAFETY_CHECKERS_APP_GOLDEN_CORE_ID, SAFETY_CHECKERS_APP_GOLDEN_MAX_SECTIONS);
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        status = SafetyCheckers_goldenAddPm(image);
+    }
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        status = SafetyCheckers_goldenAddRm(image);
+    }
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        status = SafetyCheckers_goldenFinish(image);
+    }
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        status = SafetyCheckers_goldenRetainSeal(region, SAFETY_CHECKERS_APP_GOLDEN_RETAIN_SIZE);
+    }
+
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        *goldenImage = image;
+        SAFETY_CHECKERS_log("Golden image captured in the retained region\r\n");
+    }
+    else
+    {
+        SAFETY_CHECKERS_log("Golden image capture in the retained region failed\r\n");
+    }
+
+    return status;
+}
+
+static int32_t SafetyCheckersApp_pmWarmResetRecapture(void)
+{
+    int32_t         status = SAFETY_CHECKERS_SOK;
+    uint32_t       *region = (uint32_t *)gSafetyCheckersAppGoldenRetain;
+    const uint32_t *goldenImage = NULL;
+    uint32_t        bootCount = 0U;
+
+    /* An invalidated region is not a fault on a warm boot, a new golden image is captured */
+    status = SafetyCheckers_goldenRetainInvalidate(region);
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        if(SafetyCheckers_goldenRetainRestore(region, SAFETY_CHECKERS_APP_GOLDEN_RETAIN_SIZE,
+                                              &goldenImage, &bootCount) != SAFETY_CHECKERS_FAIL)
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+    }
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        status = SafetyCheckersApp_pmWarmResetCapture(region, &goldenImage);
+    }
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        status = SafetyCheckers_goldenRetainRestore(region, SAFETY_CHECKERS_APP_GOLDEN_RETAIN_SIZE,
+                                                    &goldenImage, &bootCount);
+    }
+
+    if(SAFETY_CHECKERS_SOK != status)
+    {
+        SAFETY_CHECKERS_log("Golden image re-capture after invalidate failed\r\n");
+    }
+
+    return status;
+}
@@ -46,12 +46,28 @@
 #include <safety_checkers_common.h>
 #include <safety_checkers_soc.h>
 #include <safety_checkers_rm.h>
+#include <safety_checkers_golden.h>
 
 /* ========================================================================== */
 /*                           Macros & Typedefs                                */
 /* ========================================================================== */
 
 #define SAFETY_CHECKERS_RM_INSUFFICIENT_SIZE	(10U)
+/** \brief Register and time budget of one time sliced verify step */
+#define SAFETY_CHECKERS_RM_STEP_MAX_REG         (256U)
+#define SAFETY_CHECKERS_RM_STEP_MAX_TIME_USEC   (100U)
+/** \brief Number of registers in the snapshot scratch buffer */
+#define SAFETY_CHECKERS_RM_SNAPSHOT_SIZE        (512U)
+/** \brief Shortest register run copied through the snapshot backend */
+#define SAFETY_CHECKERS_RM_SNAPSHOT_MIN_RUN     (16U)
+/** \brief Golden image directory entries, one per RM module */
+#define SAFETY_CHECKERS_RM_GOLDEN_MAX_SECTIONS  (64U)
+/** \brief Golden image size in 32-bit words */
+#define SAFETY_CHECKERS_RM_GOLDEN_IMAGE_SIZE    (SAFETY_CHECKERS_GOLDEN_HDR_WORDS + \
+                                                 (SAFETY_CHECKERS_RM_GOLDEN_MAX_SECTIONS * SAFETY_CHECKERS_GOLDEN_SEC_WORDS) + \
+                                                 SAFETY_CHECKERS_RM_REGDUMP_SIZE)
+/** \brief Application defined core id stored in the golden image */
+#define SAFETY_CHECKERS_RM_GOLDEN_CORE_ID       (0U)
 
 /** \brief RM Register Change.
  *         This is to check the register change for the mismatch verification.
@@ -76,12 +92,23 @@
 
 void SafetyCheckersApp_rmRun(void *arg0);
 extern uint64_t SafetyCheckersApp_getTimeUsec(void);
+#if defined (SAFETY_CHECKERS_APP_UDMA_SNAPSHOT)
+extern int32_t SafetyCheckersApp_rmUdmaSnapshotInit(SafetyCheckers_SnapshotOps *snapshotOps);
+extern int32_t SafetyCheckersApp_rmUdmaSnapshotDeinit(void);
+#endif
 
 /* ========================================================================== */
 /*                            Global Variables                                */
 /* ========================================================================== */
 
 uintptr_t rmRegisterData[SAFETY_CHECKERS_RM_REGDUMP_SIZE];
+uint64_t  rmRegisterSig[SAFETY_CHECKERS_RM_REGSIG_SIZE];
+uint64_t  rmRegisterSigTree[SAFETY_CHECKERS_SIG_TREE_SIZE];
+uint64_t  rmRegisterSigTreeWork[SAFETY_CHECKERS_SIG_TREE_SIZE];
+/* Cache line aligned, the snapshot halves can be filled by DMA */
+uint32_t  rmRegisterSnapshot[SAFETY_CHECKERS_RM_SNAPSHOT_SIZE] __attribute__((aligned(128)));
+/* 64-bit elements keep the golden image 8 byte aligned */
+uint64_t  rmGoldenImage[(SAFETY_CHECKERS_RM_GOLDEN_IMAGE_SIZE + 1U) / 2U];
 
 /* ========================================================================== */
 /*                  Internal/Private Function Declarations                    */
@@ -91,6 +118,11 @@ static int32_t SafetyCheckersApp_rmregVerify();
 static int32_t SafetyCheckersApp_rmPerfTest(void);
 static int32_t SafetyCheckersApp_rmBuffCheck();
 static int32_t SafetyCheckersApp_rmRegMismatch();
+static int32_t SafetyCheckersApp_rmSigVerify(void);
+static int32_t SafetyCheckersApp_rmSigTreeVerify(void);
+static int32_t SafetyCheckersApp_rmSlicedVerify(void);
+static int32_t SafetyCheckersApp_rmSnapshotVerify(void);
+static int32_t SafetyCheckersApp_rmGoldenImageVerify(void);
 
 /* ========================================================================== */
 /*                          Function Definitions                              */
@@ -112,6 +144,31 @@ void SafetyCheckersApp_rmRun(void *arg0)
 		status = SafetyCheckersApp_rmPerfTest();
 	}
 
+	if(status == SAFETY_CHECKERS_SOK)
+	{
+		status = SafetyCheckersApp_rmSigVerify();
+	}
+
+	if(status == SAFETY_CHECKERS_SOK)
+	{
+		status = SafetyCheckersApp_rmSigTreeVerify();
+	}
+
+	if(status == SAFETY_CHECKERS_SOK)
+	{
+		status = SafetyCheckersApp_rmSlicedVerify();
+	}
+
+	if(status == SAFETY_CHECKERS_SOK)
+	{
+		status = SafetyCheckersApp_rmSnapshotVerify();
+	}
+
+	if(status == SAFETY_CHECKERS_SOK)
+	{
+		status = SafetyCheckersApp_rmGoldenImageVerify();
+	}
+
 	if(status == SAFETY_CHECKERS_SOK)
 	{
 		SAFETY_CHECKERS_log("All tests have PASSED.\r\n");
@@ -253,3 +310,266 @@ static int32_t SafetyCheckersApp_rmPerfTest(void)
 
     return (status);
 }
+
+static int32_t SafetyCheckersApp_rmSigVerify(void)
+{
+    int32_t      status = SAFETY_CHECKERS_FAIL;
+    uint64_t     startTime = 0U;
+    uint64_t     endTime = 0U;
+    uint32_t     timeDiff = 0U;
+
+    /* Get the RM register signatures */
+    status = SafetyCheckers_rmGetRegSig (rmRegisterSig, SAFETY_CHECKERS_RM_REGSIG_SIZE);
+
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        startTime = SafetyCheckersApp_getTimeUsec();
+
+        /* validate register signatures with current value */
+        status = SafetyCheckers_rmVerifyRegSig (rmRegisterSig, SAFETY_CHECKERS_RM_REGSIG_SIZE);
+
+        endTime = SafetyCheckersApp_getTimeUsec();
+        timeDiff = endTime - startTime;
+
+        SAFETY_CHECKERS_log("\nTime taken for the execution of RM register signature readback : %d usecs\r\n", timeDiff);
+    }
+
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        status = SafetyCheckers_rmVerifyRegSig (rmRegisterSig, 0U);
+        if(SAFETY_CHECKERS_INSUFFICIENT_BUFF == status)
+        {
+            SAFETY_CHECKERS_log("\nRM register signature test pass\r\n\n");
+            status = SAFETY_CHECKERS_SOK;
+        }
+        else
+        {
+            SAFETY_CHECKERS_log("\nRM register signature test fail!!\r\n\n");
+            status = SAFETY_CHECKERS_FAIL;
+        }
+    }
+
+    return (status);
+}
+
+static int32_t SafetyCheckersApp_rmSigTreeVerify(void)
+{
+    int32_t                     status = SAFETY_CHECKERS_FAIL;
+    SafetyCheckers_SigMismatch  mismatch;
+#if ((defined (SOC_AM62AX) || defined(SOC_AM62X)) || defined (BUILD_WKUP_R5) || defined (BUILD_MCU1_0))
+    uint32_t                    readVal;
+#endif
+
+    status = SafetyCheckers_rmGetRegSigTree (rmRegisterSigTree, SAFETY_CHECKERS_SIG_TREE_SIZE);
+
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        status = SafetyCheckers_rmVerifyRegSigTree (rmRegisterSigTree, rmRegisterSigTreeWork,
+                                                    SAFETY_CHECKERS_SIG_TREE_SIZE, &mismatch);
+    }
+
+    /* Register change is only possible on the cores listed in SafetyCheckersApp_rmregVerify */
+#if ((defined (SOC_AM62AX) || defined(SOC_AM62X)) || defined (BUILD_WKUP_R5) || defined (BUILD_MCU1_0))
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        readVal = CSL_REG32_RD(SAFETY_CHECKERS_RM_REG_MOD_BASE_ADDR);
+        CSL_REG32_WR(SAFETY_CHECKERS_RM_REG_MOD_BASE_ADDR, ~readVal);
+
+        status = SafetyCheckers_rmVerifyRegSigTree (rmRegisterSigTree, rmRegisterSigTreeWork,
+                                                    SAFETY_CHECKERS_SIG_TREE_SIZE, &mismatch);
+
+        if(SAFETY_CHECKERS_REG_DATA_MISMATCH == status)
+        {
+            SAFETY_CHECKERS_log("\nRM mismatch in module %d instance %d from 0x%x (%d registers)\r\n",
+                                mismatch.module, mismatch.instance, mismatch.regAddr, mismatch.regCount);
+
+            /* Narrow the range down against the golden dump of SafetyCheckersApp_rmPerfTest */
+            status = SafetyCheckers_rmLocateRegSigMismatch (rmRegisterData, SAFETY_CHECKERS_RM_REGDUMP_SIZE,
+                                                            &mismatch);
+        }
+        CSL_REG32_WR(SAFETY_CHECKERS_RM_REG_MOD_BASE_ADDR, readVal);
+
+        if((SAFETY_CHECKERS_REG_DATA_MISMATCH == status) &&
+           (SAFETY_CHECKERS_RM_REG_MOD_BASE_ADDR == mismatch.regAddr))
+        {
+            SAFETY_CHECKERS_log("\nRM mismatch in module %d instance %d at 0x%x\r\n",
+                                mismatch.module, mismatch.instance, mismatch.regAddr);
+            status = SAFETY_CHECKERS_SOK;
+        }
+        else
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+    }
+#endif
+
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        SAFETY_CHECKERS_log("\nRM register signature tree test pass\r\n\n");
+    }
+    else
+    {
+        SAFETY_CHECKERS_log("\nRM register signature tree test fail!!\r\n\n");
+    }
+
+    return (status);
+}
+
+static int32_t SafetyCheckersApp_rmSlicedVerify(void)
+{
+    int32_t                        status = SAFETY_CHECKERS_FAIL;
+    uint32_t                       stepCnt = 0U;
+    SafetyCheckers_RmVerifyCursor  cursor;
+
+    /* rmRegisterData holds the golden dump taken by SafetyCheckersApp_rmPerfTest */
+    status = SafetyCheckers_rmVerifyStart (&cursor, rmRegisterData, SAFETY_CHECKERS_RM_REGDUMP_SIZE,
+                                           SafetyCheckersApp_getTimeUsec);
+
+    while((SAFETY_CHECKERS_SOK == status) && (cursor.sweepDone == 0U))
+    {
+        /* In a periodic task each step is called from a separate task instance */
+        status = SafetyCheckers_rmVerifyStep (&cursor, SAFETY_CHECKERS_RM_STEP_MAX_REG,
+                                              SAFETY_CHECKERS_RM_STEP_MAX_TIME_USEC);
+        stepCnt++;
+    }
+
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        status = SafetyCheckers_rmVerifyFinish (&cursor);
+    }
+
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        SAFETY_CHECKERS_log("\nRM time sliced verify test pass in %d steps\r\n\n", stepCnt);
+    }
+    else
+    {
+        SAFETY_CHECKERS_log("\nRM time sliced verify test fail!!\r\n\n");
+    }
+
+    return (status);
+}
+
+static int32_t SafetyCheckersApp_rmSnapshotVerify(void)
+{
+    int32_t                     status = SAFETY_CHECKERS_FAIL;
+    uint64_t                    startTime = 0U;
+    uint64_t                    endTime = 0U;
+    uint32_t                    timeDiff = 0U;
+    SafetyCheckers_SnapshotOps  snapshotOps;
+    SafetyCheckers_RmPipelineStats pipeStats;
+#if defined (SAFETY_CHECKERS_APP_UDMA_SNAPSHOT)
+    uint32_t                    udmaOpen = 0U;
+#endif
+
+#if defined (SAFETY_CHECKERS_APP_UDMA_SNAPSHOT)
+    /* UDMA block copy backend, the register runs are copied by a TR block copy channel */
+    status = SafetyCheckersApp_rmUdmaSnapshotInit(&snapshotOps);
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        SAFETY_CHECKERS_log("\nRM snapshot backend: UDMA block copy\r\n");
+        udmaOpen = 1U;
+    }
+#else
+    /* No DMA driver in this build, the runs are read by the CPU */
+    snapshotOps.snapshotStart = SafetyCheckers_snapshotCpuStart;
+    snapshotOps.snapshotWait  = SafetyCheckers_snapshotCpuWait;
+    snapshotOps.arg           = NULL;
+    status = SAFETY_CHECKERS_SOK;
+    SAFETY_CHECKERS_log("\nRM snapshot backend: CPU\r\n");
+#endif
+    snapshotOps.minCount      = SAFETY_CHECKERS_RM_SNAPSHOT_MIN_RUN;
+
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        startTime = SafetyCheckersApp_getTimeUsec();
+
+        /* rmRegisterData holds the golden dump taken by SafetyCheckersApp_rmPerfTest */
+        status = SafetyCheckers_rmVerifyRegCfgSnapshot (rmRegisterData, SAFETY_CHECKERS_RM_REGDUMP_SIZE, &snapshotOps,
+                                                        rmRegisterSnapshot, SAFETY_CHECKERS_RM_SNAPSHOT_SIZE);
+
+        endTime = SafetyCheckersApp_getTimeUsec();
+        timeDiff = endTime - startTime;
+    }
+
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        SAFETY_CHECKERS_log("\nRM snapshot verify test pass in %d usecs\r\n\n", timeDiff);
+
+        /* Same sweep with the snapshot buffer split in two, the next run is fetched while one is compared */
+        status = SafetyCheckers_rmVerifyRegCfgPipelined (rmRegisterData, SAFETY_CHECKERS_RM_REGDUMP_SIZE, &snapshotOps,
+                                                         rmRegisterSnapshot, SAFETY_CHECKERS_RM_SNAPSHOT_SIZE / 2U,
+                                                         SafetyCheckersApp_getTimeUsec, &pipeStats);
+    }
+
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        SAFETY_CHECKERS_log("\nRM pipelined verify test pass in %d usecs (fetch %d usecs, compare %d usecs, %d runs)\r\n\n",
+                            (uint32_t)pipeStats.totalUsec, (uint32_t)pipeStats.fetchUsec,
+                            (uint32_t)pipeStats.compareUsec, pipeStats.runCnt);
+    }
+    else
+    {
+        SAFETY_CHECKERS_log("\nRM snapshot verify test fail!!\r\n\n");
+    }
+
+#if defined (SAFETY_CHECKERS_APP_UDMA_SNAPSHOT)
+    if((udmaOpen != 0U) && (SAFETY_CHECKERS_SOK != SafetyCheckersApp_rmUdmaSnapshotDeinit()))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+#endif
+
+    return (status);
+}
+
+static int32_t SafetyCheckersApp_rmGoldenImageVerify(void)
+{
+    int32_t   status = SAFETY_CHECKERS_FAIL;
+    uint32_t *image = (uint32_t *)rmGoldenImage;
+    const uint32_t *moduleData = NULL;
+    uint32_t  moduleCount = 0U;
+
+    status = SafetyCheckers_goldenInit(image, SAFETY_CHECKERS_RM_GOLDEN_IMAGE_SIZE,
+                                       SAFETY_CHECKERS_RM_GOLDEN_CORE_ID, SAFETY_CHECKERS_RM_GOLDEN_MAX_SECTIONS);
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        status = SafetyCheckers_goldenAddRm(image);
+    }
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        status = SafetyCheckers_goldenFinish(image);
+    }
+
+    /* An image loaded from storage is validated once before it is used */
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        status = SafetyCheckers_goldenValidate(image, SAFETY_CHECKERS_RM_GOLDEN_IMAGE_SIZE);
+    }
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        status = SafetyCheckers_goldenVerify(image, SAFETY_CHECKERS_GOLDEN_SEC_TYPE_MASK(SAFETY_CHECKERS_GOLDEN_SEC_TYPE_RM));
+    }
+
+    /* Any single module can be located and verified straight from the image */
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        status = SafetyCheckers_goldenGetSection(image, SAFETY_CHECKERS_GOLDEN_SEC_TYPE_RM, 0U, &moduleData, &moduleCount);
+    }
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        status = SafetyCheckers_rmVerifyModuleRegCfg32(0U, moduleData, moduleCount);
+    }
+
+    if(SAFETY_CHECKERS_SOK == status)
+    {
+        SAFETY_CHECKERS_log("\nRM golden image verify test pass, image size %d bytes\r\n\n",
+                            ((const SafetyCheckers_GoldenHdr *)image)->imageSize);
+    }
+    else
+    {
+        SAFETY_CHECKERS_log("\nRM golden image verify test fail!!\r\n\n");
+    }
+
+    return (status);
+}
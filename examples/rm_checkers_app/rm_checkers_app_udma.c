@@ -0,0 +1,331 @@
+/*
+ *  Copyright (C) 2024 Texas Instruments Incorporated
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ *  \file     rm_checkers_app_udma.c
+ *
+ *  \brief    This file contains the UDMA block copy snapshot backend of the
+ *            RM safety checkers app. Each register run is copied by one
+ *            TR15 transfer of a TR block copy channel, icnt0 = 4 bytes and
+ *            icnt1 = registers of the run at the register stride, into the
+ *            contiguous snapshot buffer. The channel is polled, the CPU only
+ *            compares the snapshot once the copy is complete.
+ *
+ */
+
+/*===========================================================================*/
+/*                         Include files                                     */
+/*===========================================================================*/
+
+#include <stdint.h>
+#include <ti/drv/udma/udma.h>
+#include <ti/osal/CacheP.h>
+#include <safety_checkers_common.h>
+
+/* ========================================================================== */
+/*                           Macros & Typedefs                                */
+/* ========================================================================== */
+
+/** \brief UDMA instance used for the register snapshot */
+#if defined (BUILD_MCU1_0)
+#define SAFETY_CHECKERS_APP_UDMA_INST_ID        (UDMA_INST_ID_MCU_0)
+#else
+#define SAFETY_CHECKERS_APP_UDMA_INST_ID        (UDMA_INST_ID_MAIN_0)
+#endif
+/** \brief One TR descriptor is in flight at a time */
+#define SAFETY_CHECKERS_APP_UDMA_RING_ENTRIES   (1U)
+#define SAFETY_CHECKERS_APP_UDMA_RING_MEM_SIZE  (SAFETY_CHECKERS_APP_UDMA_RING_ENTRIES * sizeof(uint64_t))
+#define SAFETY_CHECKERS_APP_UDMA_RING_MEM_ALIGN ((SAFETY_CHECKERS_APP_UDMA_RING_MEM_SIZE + UDMA_CACHELINE_ALIGNMENT) & \
+                                                 ~(UDMA_CACHELINE_ALIGNMENT - 1U))
+#define SAFETY_CHECKERS_APP_UDMA_TRPD_SIZE      (UDMA_GET_TRPD_TR15_SIZE(1U))
+#define SAFETY_CHECKERS_APP_UDMA_TRPD_ALIGN     ((SAFETY_CHECKERS_APP_UDMA_TRPD_SIZE + UDMA_CACHELINE_ALIGNMENT) & \
+                                                 ~(UDMA_CACHELINE_ALIGNMENT - 1U))
+/** \brief Longest register run of one TR, icnt1 is 16 bits */
+#define SAFETY_CHECKERS_APP_UDMA_MAX_COUNT      (0xFFFFU)
+/** \brief Time allowed for the copy of one register run */
+#define SAFETY_CHECKERS_APP_UDMA_TIMEOUT_USEC   (1000U)
+
+/* ========================================================================== */
+/*                         Structure Declarations                             */
+/* ========================================================================== */
+
+typedef struct
+{
+    struct Udma_DrvObj drvObj;
+    struct Udma_ChObj  chObj;
+    /* Snapshot buffer and size of the copy in flight */
+    uint32_t          *dst;
+    uint32_t           dstSize;
+    /* Copy in flight */
+    uint32_t           busy;
+} SafetyCheckersApp_RmUdmaObj;
+
+/* ========================================================================== */
+/*                          Function Declarations                             */
+/* ========================================================================== */
+
+int32_t SafetyCheckersApp_rmUdmaSnapshotInit(SafetyCheckers_SnapshotOps *snapshotOps);
+int32_t SafetyCheckersApp_rmUdmaSnapshotDeinit(void);
+extern uint64_t SafetyCheckersApp_getTimeUsec(void);
+
+/* ========================================================================== */
+/*                            Global Variables                                */
+/* ========================================================================== */
+
+static SafetyCheckersApp_RmUdmaObj gSafetyCheckersAppRmUdmaObj;
+static uint8_t gSafetyCheckersAppRmUdmaFqRingMem[SAFETY_CHECKERS_APP_UDMA_RING_MEM_ALIGN]
+__attribute__((aligned(UDMA_CACHELINE_ALIGNMENT)));
+static uint8_t gSafetyCheckersAppRmUdmaCqRingMem[SAFETY_CHECKERS_APP_UDMA_RING_MEM_ALIGN]
+__attribute__((aligned(UDMA_CACHELINE_ALIGNMENT)));
+static uint8_t gSafetyCheckersAppRmUdmaTdCqRingMem[SAFETY_CHECKERS_APP_UDMA_RING_MEM_ALIGN]
+__attribute__((aligned(UDMA_CACHELINE_ALIGNMENT)));
+static uint8_t gSafetyCheckersAppRmUdmaTrpdMem[SAFETY_CHECKERS_APP_UDMA_TRPD_ALIGN]
+__attribute__((aligned(UDMA_CACHELINE_ALIGNMENT)));
+
+/* ========================================================================== */
+/*                  Internal/Private Function Declarations                    */
+/* ========================================================================== */
+
+static int32_t SafetyCheckersApp_rmUdmaStart(void *arg, uint32_t srcAddr, uint32_t srcStride,
+                                             uint32_t count, uint32_t *dst);
+static int32_t SafetyCheckersApp_rmUdmaWait(void *arg);
+
+/* ========================================================================== */
+/*                          Function Definitions                              */
+/* ========================================================================== */
+
+int32_t SafetyCheckersApp_rmUdmaSnapshotInit(SafetyCheckers_SnapshotOps *snapshotOps)
+{
+    int32_t         status = SAFETY_CHECKERS_SOK;
+    uint32_t        chType = UDMA_CH_TYPE_TR_BLK_COPY;
+    Udma_InitPrms   initPrms;
+    Udma_ChPrms     chPrms;
+    Udma_ChTxPrms   txPrms;
+    Udma_ChRxPrms   rxPrms;
+    SafetyCheckersApp_RmUdmaObj *udmaObj = &gSafetyCheckersAppRmUdmaObj;
+
+    if (snapshotOps == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        UdmaInitPrms_init(SAFETY_CHECKERS_APP_UDMA_INST_ID, &initPrms);
+        if (Udma_init(&udmaObj->drvObj, &initPrms) != UDMA_SOK)
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        UdmaChPrms_init(&chPrms, chType);
+        chPrms.fqRingPrms.ringMem       = gSafetyCheckersAppRmUdmaFqRingMem;
+        chPrms.cqRingPrms.ringMem       = gSafetyCheckersAppRmUdmaCqRingMem;
+        chPrms.tdCqRingPrms.ringMem     = gSafetyCheckersAppRmUdmaTdCqRingMem;
+        chPrms.fqRingPrms.ringMemSize   = SAFETY_CHECKERS_APP_UDMA_RING_MEM_SIZE;
+        chPrms.cqRingPrms.ringMemSize   = SAFETY_CHECKERS_APP_UDMA_RING_MEM_SIZE;
+        chPrms.tdCqRingPrms.ringMemSize = SAFETY_CHECKERS_APP_UDMA_RING_MEM_SIZE;
+        chPrms.fqRingPrms.elemCnt       = SAFETY_CHECKERS_APP_UDMA_RING_ENTRIES;
+        chPrms.cqRingPrms.elemCnt       = SAFETY_CHECKERS_APP_UDMA_RING_ENTRIES;
+        chPrms.tdCqRingPrms.elemCnt     = SAFETY_CHECKERS_APP_UDMA_RING_ENTRIES;
+
+        if (Udma_chOpen(&udmaObj->drvObj, &udmaObj->chObj, chType, &chPrms) != UDMA_SOK)
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        UdmaChTxPrms_init(&txPrms, chType);
+        UdmaChRxPrms_init(&rxPrms, chType);
+        if ((Udma_chConfigTx(&udmaObj->chObj, &txPrms) != UDMA_SOK) ||
+            (Udma_chConfigRx(&udmaObj->chObj, &rxPrms) != UDMA_SOK) ||
+            (Udma_chEnable(&udmaObj->chObj) != UDMA_SOK))
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        udmaObj->busy = 0U;
+        snapshotOps->snapshotStart = SafetyCheckersApp_rmUdmaStart;
+        snapshotOps->snapshotWait  = SafetyCheckersApp_rmUdmaWait;
+        snapshotOps->arg           = udmaObj;
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckersApp_rmUdmaSnapshotDeinit(void)
+{
+    int32_t status = SAFETY_CHECKERS_SOK;
+    SafetyCheckersApp_RmUdmaObj *udmaObj = &gSafetyCheckersAppRmUdmaObj;
+
+    if ((Udma_chDisable(&udmaObj->chObj, UDMA_DEFAULT_CH_DISABLE_TIMEOUT) != UDMA_SOK) ||
+        (Udma_chClose(&udmaObj->chObj) != UDMA_SOK) ||
+        (Udma_deinit(&udmaObj->drvObj) != UDMA_SOK))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    return (status);
+}
+
+/* ========================================================================== */
+/*                   Internal/Private Function Definitions                    */
+/* ========================================================================== */
+
+static int32_t SafetyCheckersApp_rmUdmaStart(void *arg, uint32_t srcAddr, uint32_t srcStride,
+                                             uint32_t count, uint32_t *dst)
+{
+    int32_t         status = SAFETY_CHECKERS_SOK;
+    uint8_t        *trpdMem = gSafetyCheckersAppRmUdmaTrpdMem;
+    CSL_UdmapTR15  *pTr;
+    SafetyCheckersApp_RmUdmaObj *udmaObj = (SafetyCheckersApp_RmUdmaObj *)arg;
+
+    if ((udmaObj == NULL) || (dst == NULL) || (udmaObj->busy != 0U) ||
+        (count == 0U) || (count > SAFETY_CHECKERS_APP_UDMA_MAX_COUNT))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        /* Drop the snapshot lines from the cache so no eviction overwrites the copied data */
+        udmaObj->dst     = dst;
+        udmaObj->dstSize = count * (uint32_t)sizeof(uint32_t);
+        CacheP_wbInv(dst, (int32_t)udmaObj->dstSize);
+
+        UdmaUtils_makeTrpd(trpdMem, UDMA_TR_TYPE_15, 1U, Udma_chGetCqRingNum(&udmaObj->chObj));
+        pTr = UdmaUtils_getTrpdTr15Pointer(trpdMem, 0U);
+
+        pTr->flags  = CSL_FMK(UDMAP_TR_FLAGS_TYPE, CSL_UDMAP_TR_FLAGS_TYPE_4D_BLOCK_MOVE_REPACKING_INDIRECTION);
+        pTr->flags |= CSL_FMK(UDMAP_TR_FLAGS_STATIC, 0U);
+        pTr->flags |= CSL_FMK(UDMAP_TR_FLAGS_EOL, CSL_UDMAP_TR_FLAGS_EOL_MATCH_SOL_EOL);
+        pTr->flags |= CSL_FMK(UDMAP_TR_FLAGS_EVENT_SIZE, CSL_UDMAP_TR_FLAGS_EVENT_SIZE_COMPLETION);
+        pTr->flags |= CSL_FMK(UDMAP_TR_FLAGS_TRIGGER0, CSL_UDMAP_TR_FLAGS_TRIGGER_NONE);
+        pTr->flags |= CSL_FMK(UDMAP_TR_FLAGS_TRIGGER0_TYPE, CSL_UDMAP_TR_FLAGS_TRIGGER_TYPE_ALL);
+        pTr->flags |= CSL_FMK(UDMAP_TR_FLAGS_TRIGGER1, CSL_UDMAP_TR_FLAGS_TRIGGER_NONE);
+        pTr->flags |= CSL_FMK(UDMAP_TR_FLAGS_TRIGGER1_TYPE, CSL_UDMAP_TR_FLAGS_TRIGGER_TYPE_ALL);
+        pTr->flags |= CSL_FMK(UDMAP_TR_FLAGS_CMD_ID, 0x25U);
+        pTr->flags |= CSL_FMK(UDMAP_TR_FLAGS_SA_INDIRECT, 0U);
+        pTr->flags |= CSL_FMK(UDMAP_TR_FLAGS_DA_INDIRECT, 0U);
+        pTr->flags |= CSL_FMK(UDMAP_TR_FLAGS_EOP, 1U);
+
+        /* Source: count 32-bit registers, srcStride bytes apart */
+        pTr->icnt0    = (uint16_t)sizeof(uint32_t);
+        pTr->icnt1    = (uint16_t)count;
+        pTr->icnt2    = 1U;
+        pTr->icnt3    = 1U;
+        pTr->dim1     = (int32_t)srcStride;
+        pTr->dim2     = (int32_t)(srcStride * count);
+        pTr->dim3     = (int32_t)(srcStride * count);
+        pTr->addr     = (uint64_t)srcAddr;
+        pTr->fmtflags = 0x00000000U;
+
+        /* Destination: the contiguous snapshot buffer */
+        pTr->dicnt0   = (uint16_t)sizeof(uint32_t);
+        pTr->dicnt1   = (uint16_t)count;
+        pTr->dicnt2   = 1U;
+        pTr->dicnt3   = 1U;
+        pTr->ddim1    = (int32_t)sizeof(uint32_t);
+        pTr->ddim2    = (int32_t)udmaObj->dstSize;
+        pTr->ddim3    = (int32_t)udmaObj->dstSize;
+        pTr->daddr    = (uint64_t)Udma_defaultVirtToPhyFxn(dst, 0U, NULL);
+
+        CacheP_wb(trpdMem, SAFETY_CHECKERS_APP_UDMA_TRPD_SIZE);
+
+        if (Udma_ringQueueRaw(Udma_chGetFqRingHandle(&udmaObj->chObj),
+                              (uint64_t)Udma_defaultVirtToPhyFxn(trpdMem, 0U, NULL)) != UDMA_SOK)
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+        else
+        {
+            udmaObj->busy = 1U;
+        }
+    }
+
+    return (status);
+}
+
+static int32_t SafetyCheckersApp_rmUdmaWait(void *arg)
+{
+    int32_t         status = SAFETY_CHECKERS_SOK;
+    int32_t         ringStatus = UDMA_EFAIL;
+    uint64_t        pDesc = 0U;
+    uint64_t        startTime;
+    uint8_t        *trpdMem = gSafetyCheckersAppRmUdmaTrpdMem;
+    SafetyCheckersApp_RmUdmaObj *udmaObj = (SafetyCheckersApp_RmUdmaObj *)arg;
+
+    if ((udmaObj == NULL) || (udmaObj->busy == 0U))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        /* Poll the completion queue for the TR descriptor */
+        startTime = SafetyCheckersApp_getTimeUsec();
+        do
+        {
+            ringStatus = Udma_ringDequeueRaw(Udma_chGetCqRingHandle(&udmaObj->chObj), &pDesc);
+        } while ((ringStatus != UDMA_SOK) &&
+                 ((SafetyCheckersApp_getTimeUsec() - startTime) < SAFETY_CHECKERS_APP_UDMA_TIMEOUT_USEC));
+
+        if (ringStatus != UDMA_SOK)
+        {
+            /* The descriptor stays queued, the channel is not used again */
+            status = SAFETY_CHECKERS_FAIL;
+        }
+        else
+        {
+            udmaObj->busy = 0U;
+            CacheP_Inv(trpdMem, SAFETY_CHECKERS_APP_UDMA_TRPD_SIZE);
+            if ((pDesc != (uint64_t)Udma_defaultVirtToPhyFxn(trpdMem, 0U, NULL)) ||
+                (UdmaUtils_getTrpdTr15Response(trpdMem, 1U, 0U) != CSL_UDMAP_TR_RESPONSE_STATUS_COMPLETE))
+            {
+                status = SAFETY_CHECKERS_FAIL;
+            }
+
+            /* Read the registers copied by the DMA, not stale cache lines */
+            CacheP_Inv(udmaObj->dst, (int32_t)udmaObj->dstSize);
+        }
+    }
+
+    return (status);
+}
@@ -32,6 +32,7 @@
 
 #include <stdlib.h>
 #include <kernel/dpl/DebugP.h>
+#include <kernel/dpl/ClockP.h>
 #include "ti_drivers_config.h"
 #include "ti_board_config.h"
 #include "ti_drivers_open_close.h"
@@ -48,6 +49,7 @@ TaskHandle_t gMainTask;
 
 void SafetyCheckersApp_tifsTest(void *args);
 void SafetyCheckersApp_tifsTestFwlOpenClose(void *args);
+void SafetyCheckersApp_tifsSessionTest(void *args);
 void SafetyCheckersApp_tifsNegativeTests(void *args);
 
 void freertos_main(void *args)
@@ -59,6 +61,8 @@ void freertos_main(void *args)
 
     SafetyCheckersApp_tifsTestFwlOpenClose(NULL);
 
+    SafetyCheckersApp_tifsSessionTest(NULL);
+
     SafetyCheckersApp_tifsNegativeTests(NULL);
 
     #if defined LDRA_DYN_COVERAGE_EXIT
@@ -101,3 +105,8 @@ int main()
 
     return 0;
 }
+
+uint64_t SafetyCheckersApp_getTimeUsec(void)
+{
+    return (ClockP_getTimeUsec());
+}
@@ -52,6 +52,7 @@ TaskHandle_t gMainTask;
 
 void SafetyCheckersApp_tifsTest(void *args);
 void SafetyCheckersApp_tifsTestFwlOpenClose(void *args);
+void SafetyCheckersApp_tifsSessionTest(void *args);
 void SafetyCheckersApp_tifsNegativeTests(void *args);
 
 void main_thread(void *args)
@@ -65,6 +66,8 @@ void main_thread(void *args)
 
     SafetyCheckersApp_tifsTestFwlOpenClose(NULL);
 
+    SafetyCheckersApp_tifsSessionTest(NULL);
+
     SafetyCheckersApp_tifsNegativeTests(NULL);
 
     #if defined LDRA_DYN_COVERAGE_EXIT
@@ -106,3 +109,8 @@ int main()
 
     return 0;
 }
+
+uint64_t SafetyCheckersApp_getTimeUsec(void)
+{
+    return (ClockP_getTimeUsec());
+}
@@ -46,7 +46,12 @@
 /*                           Macros & Typedefs                                */
 /* ========================================================================== */
 
-/* None */
+/* Time an idle firewall session stays open before it is closed */
+#define SAFETY_CHECKERS_APP_FWL_HOLD_USEC               (50000U)
+/* Sciclient timeout of the asynchronous firewall requests */
+#define SAFETY_CHECKERS_APP_FWL_REQ_TIMEOUT             (1000U)
+/* Time the checker task waits for a request that no worker processes */
+#define SAFETY_CHECKERS_APP_FWL_REQ_WAIT_USEC           (1000U)
 
 /* ========================================================================== */
 /*                         Structure Declarations                             */
@@ -59,6 +64,10 @@
 /* ========================================================================== */
 
 void SafetyCheckersApp_tifsTestFwlOpenClose(void *args);
+void SafetyCheckersApp_tifsSessionTest(void *args);
+void SafetyCheckersApp_tifsAsyncReqTest(void *args);
+static void SafetyCheckersApp_tifsReqDone(void *arg, int32_t reqStatus);
+extern uint64_t SafetyCheckersApp_getTimeUsec(void);
 void SafetyCheckersApp_tifsNegativeTests(void *args);
 void SafetyCheckersApp_tifsRegisterMismatchTest(void *args);
 void SafetyCheckersApp_tifsInvalidInputTest(void *args);
@@ -68,8 +77,7 @@ void SafetyCheckersApp_softwareDelay(void);
 /*                            Global Variables                                */
 /* ========================================================================== */
 
-SafetyCheckers_TifsFwlConfig *pFwlConfig = gSafetyCheckers_TifsFwlConfig;
-uint32_t gSafetyCheckersTifsCfgSize = TIFS_CHECKER_FWL_MAX_NUM;
+SafetyCheckers_TifsFwlPackedConfig *pFwlConfig = &gSafetyCheckers_TifsFwlPackedConfig;
 
 /* ========================================================================== */
 /*                          Function Definitions                              */
@@ -96,7 +104,7 @@ void SafetyCheckersApp_tifsTest(void *args)
 
     if (status == SAFETY_CHECKERS_SOK)
     {
-        status = SafetyCheckers_tifsGetFwlCfg(pFwlConfig, gSafetyCheckersTifsCfgSize);
+        status = SafetyCheckers_tifsGetFwlPackedCfg(pFwlConfig);
         if (status == SAFETY_CHECKERS_SOK)
         {
             SAFETY_CHECKERS_log("Get firewall configuration successful\r\n");
@@ -110,7 +118,7 @@ void SafetyCheckersApp_tifsTest(void *args)
 
         while (i > 0)
         {
-            status = SafetyCheckers_tifsVerifyFwlCfg(pFwlConfig, gSafetyCheckersTifsCfgSize);
+            status = SafetyCheckers_tifsVerifyFwlPackedCfgMode(pFwlConfig, SAFETY_CHECKERS_TIFS_VERIFY_SKIP_DISABLED);
 
             if (status == SAFETY_CHECKERS_REG_DATA_MISMATCH)
             {
@@ -164,6 +172,129 @@ void SafetyCheckersApp_tifsTestFwlOpenClose(void *args)
     {
         SAFETY_CHECKERS_log("Firewall close unsuccessful!!\r\n");
     }
+
+    SafetyCheckersApp_tifsAsyncReqTest(NULL);
+}
+
+void SafetyCheckersApp_tifsAsyncReqTest(void *args)
+{
+    int32_t status = SAFETY_CHECKERS_SOK;
+    int32_t reqStatus = SAFETY_CHECKERS_FAIL;
+    uint32_t doneCnt = 0U;
+    uint64_t startTime = 0U;
+    SafetyCheckers_TifsFwlReq fwlReq = {0U};
+
+    SAFETY_CHECKERS_log("\n---- Test asynchronous firewall requests ----\r\n\n");
+
+    status = SafetyCheckers_tifsReqFwlOpenAsync(&fwlReq, SAFETY_CHECKERS_APP_FWL_REQ_TIMEOUT,
+                                                SafetyCheckersApp_tifsReqDone, &doneCnt);
+
+    /* No worker has run yet, the checker task gives up once its wait is over */
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        startTime = SafetyCheckersApp_getTimeUsec();
+        while ((SafetyCheckers_tifsReqFwlPoll(&fwlReq, &reqStatus) != SAFETY_CHECKERS_SOK) &&
+               ((SafetyCheckersApp_getTimeUsec() - startTime) < SAFETY_CHECKERS_APP_FWL_REQ_WAIT_USEC))
+        {
+        }
+
+        if (SafetyCheckers_tifsReqFwlPoll(&fwlReq, &reqStatus) == SAFETY_CHECKERS_SOK)
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+        else
+        {
+            SAFETY_CHECKERS_log("Firewall open request wait timed out while pending\r\n");
+        }
+    }
+
+    /* A request cannot be posted again while it is pending */
+    if ((status == SAFETY_CHECKERS_SOK) &&
+        (SafetyCheckers_tifsReqFwlCloseAsync(&fwlReq, SAFETY_CHECKERS_APP_FWL_REQ_TIMEOUT, NULL, NULL) == SAFETY_CHECKERS_SOK))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    /* Worker context: send the pending open to TIFS, then the checker task polls it */
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        status = SafetyCheckers_tifsReqFwlProcess(&fwlReq);
+    }
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        status = SafetyCheckers_tifsReqFwlPoll(&fwlReq, &reqStatus);
+    }
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        status = reqStatus;
+    }
+
+    /* Same round trip for the close */
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        status = SafetyCheckers_tifsReqFwlCloseAsync(&fwlReq, SAFETY_CHECKERS_APP_FWL_REQ_TIMEOUT,
+                                                     SafetyCheckersApp_tifsReqDone, &doneCnt);
+    }
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        status = SafetyCheckers_tifsReqFwlProcess(&fwlReq);
+    }
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        status = SafetyCheckers_tifsReqFwlPoll(&fwlReq, &reqStatus);
+    }
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        status = reqStatus;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (doneCnt == 2U))
+    {
+        SAFETY_CHECKERS_log("Asynchronous firewall open and close successful\r\n");
+    }
+    else
+    {
+        SAFETY_CHECKERS_log("Asynchronous firewall requests unsuccessful!!\r\n");
+    }
+}
+
+void SafetyCheckersApp_tifsSessionTest(void *args)
+{
+    int32_t status = SAFETY_CHECKERS_SOK;
+    uint32_t i = 10U;
+    SafetyCheckers_TifsSession session;
+
+    SAFETY_CHECKERS_log("\n------- Test firewall session requests -------\r\n\n");
+
+    status = SafetyCheckers_tifsSessionInit(&session, SafetyCheckersApp_getTimeUsec, SAFETY_CHECKERS_APP_FWL_HOLD_USEC,
+                                            NULL, NULL, NULL);
+
+    /* Every check holds the session, the firewall is only opened again once the hold time is over */
+    while ((status == SAFETY_CHECKERS_SOK) && (i > 0U))
+    {
+        status = SafetyCheckers_tifsSessionAcquire(&session);
+        if (status == SAFETY_CHECKERS_SOK)
+        {
+            status = SafetyCheckers_tifsVerifyFwlPackedCfg(pFwlConfig);
+            if (status == SAFETY_CHECKERS_REG_DATA_MISMATCH)
+            {
+                SAFETY_CHECKERS_log("Firewall register mismatch with Golden Reference!!\r\n");
+            }
+            (void)SafetyCheckers_tifsSessionRelease(&session);
+        }
+
+        SafetyCheckersApp_softwareDelay();
+        i--;
+    }
+
+    if (SafetyCheckers_tifsSessionClose(&session) == SAFETY_CHECKERS_SOK)
+    {
+        SAFETY_CHECKERS_log("Firewall session closed after %d open requests\r\n", session.openCnt);
+    }
+    else
+    {
+        SAFETY_CHECKERS_log("Firewall session close unsuccessful!!\r\n");
+    }
 }
 
 void SafetyCheckersApp_tifsNegativeTests(void *args)
@@ -193,7 +324,7 @@ void SafetyCheckersApp_tifsRegisterMismatchTest(void *args)
 
     if (status == SAFETY_CHECKERS_SOK)
     {
-        status = SafetyCheckers_tifsGetFwlCfg(pFwlConfig, gSafetyCheckersTifsCfgSize);
+        status = SafetyCheckers_tifsGetFwlPackedCfg(pFwlConfig);
         if (status == SAFETY_CHECKERS_SOK)
         {
             SAFETY_CHECKERS_log("Get firewall configuration successful\r\n");
@@ -222,7 +353,7 @@ void SafetyCheckersApp_tifsRegisterMismatchTest(void *args)
         struct tisci_msg_fwl_set_firewall_region_resp fwl_set_resp = {0};
 
         status = Sciclient_firewallSetRegion(&fwl_set_req, &fwl_set_resp, SAFETY_CHECKERS_DEFAULT_TIMEOUT);
-        status = SafetyCheckers_tifsVerifyFwlCfg(pFwlConfig, gSafetyCheckersTifsCfgSize);
+        status = SafetyCheckers_tifsVerifyFwlPackedCfg(pFwlConfig);
 
         if (status == SAFETY_CHECKERS_REG_DATA_MISMATCH)
         {
@@ -267,9 +398,9 @@ void SafetyCheckersApp_tifsInvalidInputTest(void *args)
     if (status == SAFETY_CHECKERS_SOK)
     {
         /* Update numRegions with invalid value*/
-        pFwlConfig[5].numRegions= 100U;
+        pFwlConfig->fwlDir[5].numRegions = 100U;
 
-        status = SafetyCheckers_tifsGetFwlCfg(pFwlConfig, gSafetyCheckersTifsCfgSize);
+        status = SafetyCheckers_tifsGetFwlPackedCfg(pFwlConfig);
         if (status == SAFETY_CHECKERS_SOK)
         {
             SAFETY_CHECKERS_log("Get firewall configuration successful\r\n");
@@ -281,7 +412,7 @@ void SafetyCheckersApp_tifsInvalidInputTest(void *args)
 
         /* Place to verify and save firewall configuration as Golden Reference */
 
-        status = SafetyCheckers_tifsVerifyFwlCfg(pFwlConfig, gSafetyCheckersTifsCfgSize);
+        status = SafetyCheckers_tifsVerifyFwlPackedCfg(pFwlConfig);
 
         if (status == SAFETY_CHECKERS_REG_DATA_MISMATCH)
         {
@@ -307,6 +438,13 @@ void SafetyCheckersApp_tifsInvalidInputTest(void *args)
     }
 }
 
+static void SafetyCheckersApp_tifsReqDone(void *arg, int32_t reqStatus)
+{
+    uint32_t *doneCnt = (uint32_t *)arg;
+
+    (*doneCnt)++;
+}
+
 void SafetyCheckersApp_softwareDelay(void)
 {
     volatile uint32_t i = 0U;
@@ -45,6 +45,7 @@
 #include "ti/osal/osal.h"
 #include "ti/osal/TaskP.h"
 #include <ti/board/board.h>
+#include <ti/osal/TimerP.h>
 #include <ti/drv/sciclient/sciclient.h>
 #include <safety_checkers_common.h>
 
@@ -69,6 +70,8 @@
 
 void SafetyCheckersApp_tifsTest(void *args);
 void SafetyCheckersApp_tifsTestFwlOpenClose(void *args);
+void SafetyCheckersApp_tifsSessionTest(void *args);
+uint64_t SafetyCheckersApp_getTimeUsec(void);
 void SafetyCheckersApp_tifsNegativeTests(void *args);
 
 /* ========================================================================== */
@@ -103,6 +106,7 @@ static void SafetyCheckersApp_tifsTestTask(void* a0, void* a1)
     {
         SafetyCheckersApp_tifsTest(NULL);
         SafetyCheckersApp_tifsTestFwlOpenClose(NULL);
+        SafetyCheckersApp_tifsSessionTest(NULL);
         SafetyCheckersApp_tifsNegativeTests(NULL);
     }
 
@@ -137,4 +141,9 @@ int32_t main(void)
 
     return(0);
 #endif
-}
\ No newline at end of file
+}
+
+uint64_t SafetyCheckersApp_getTimeUsec(void)
+{
+    return (TimerP_getTimeInUsecs());
+}
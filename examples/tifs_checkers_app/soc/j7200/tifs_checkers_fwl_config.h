@@ -52,7 +52,8 @@ extern "C" {
 /*                           Macros & Typedefs                                */
 /* ========================================================================== */
 
-/* None */
+/* Number of regions of the shared firewall region array */
+#define TIFS_CHECKER_FWL_REGION_NUM                               (779U)
 
 /* ========================================================================== */
 /*                         Structure Declarations                             */
@@ -64,3027 +65,340 @@ extern "C" {
 /*                            Global Variables                                */
 /* ========================================================================== */
 
-/* Static firewall configuration to be populated with register values */ 
-SafetyCheckers_TifsFwlConfig gSafetyCheckers_TifsFwlConfig[TIFS_CHECKER_FWL_MAX_NUM] = {
-{
-	257U,	/* fwlId */
-	16U,	/* numRegions */
-	16U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	3U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	5U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	8U,	/* fwlId */
-	26U,	/* numRegions */
-	26U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	9U,	/* fwlId */
-	16U,	/* numRegions */
-	16U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	16U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	24U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	25U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	64U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	65U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	66U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	67U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	68U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	69U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	70U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	82U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	84U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	86U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	96U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	97U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	98U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	99U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	100U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	101U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	102U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	104U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	105U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	106U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	107U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	108U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	114U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	115U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	116U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	129U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	130U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	131U,	/* fwlId */
-	16U,	/* numRegions */
-	16U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	132U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	133U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	135U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	136U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	137U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	144U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	160U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	168U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	176U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	177U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	178U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	179U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1025U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1026U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1028U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1029U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1030U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1032U,	/* fwlId */
-	12U,	/* numRegions */
-	12U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1033U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1036U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1048U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1050U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1051U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1052U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1056U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1057U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1058U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1059U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1060U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1061U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1062U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1063U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1064U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1065U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1072U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1073U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1074U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1088U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1089U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1090U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1104U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1105U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1106U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1107U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1120U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1152U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1153U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1160U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1161U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1168U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1184U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1185U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1196U,	/* fwlId */
-	5U,	/* numRegions */
-	5U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1200U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1201U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1208U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1212U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1213U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1220U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1244U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1245U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1246U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1253U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1268U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1269U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1270U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1274U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1275U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2072U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2073U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2074U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2075U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2094U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2095U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2115U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2116U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2117U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2118U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2119U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2136U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2137U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2138U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2139U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2148U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2149U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2152U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2153U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2154U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2155U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2156U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2157U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2158U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2159U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2160U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2161U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2162U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2163U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2164U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2165U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2166U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2167U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2168U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2169U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2170U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2171U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2172U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2173U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2174U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2175U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2176U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2177U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2178U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2179U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2180U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2181U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2182U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2183U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2184U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2185U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2186U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2187U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2192U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2193U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2194U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2196U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2197U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2198U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2204U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2205U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2206U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2208U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2210U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2214U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2215U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2231U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2232U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2233U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2236U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2240U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2241U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2242U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2243U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2248U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2249U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2250U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2251U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2252U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2253U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2254U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2255U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2256U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2257U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2258U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2259U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2268U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2269U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2270U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2271U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2278U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2279U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2300U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2301U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2302U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2303U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2310U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2314U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2315U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2316U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2369U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2376U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2380U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2384U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2390U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2398U,	/* fwlId */
-	5U,	/* numRegions */
-	5U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2400U,	/* fwlId */
-	16U,	/* numRegions */
-	16U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2408U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2409U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2415U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2430U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2431U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2464U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2465U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2468U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2494U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2495U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2547U,	/* fwlId */
-	24U,	/* numRegions */
-	24U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2561U,	/* fwlId */
-	7U,	/* numRegions */
-	7U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2564U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2565U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2583U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2584U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2589U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2591U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2592U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2593U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2594U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2595U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2596U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2597U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2607U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2756U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2768U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2769U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2770U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2771U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2772U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2773U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2777U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2778U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2779U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2780U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4160U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4161U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4288U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4352U,	/* fwlId */
-	7U,	/* numRegions */
-	7U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4384U,	/* fwlId */
-	6U,	/* numRegions */
-	6U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4385U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4386U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4387U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4608U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4609U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4610U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4611U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4624U,	/* fwlId */
-	12U,	/* numRegions */
-	12U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4632U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4640U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4648U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4656U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4664U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4680U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4681U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4682U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4683U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4688U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4704U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4744U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4745U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4753U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4760U,	/* fwlId */
-	24U,	/* numRegions */
-	24U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4761U,	/* fwlId */
-	24U,	/* numRegions */
-	24U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4762U,	/* fwlId */
-	24U,	/* numRegions */
-	24U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4763U,	/* fwlId */
-	24U,	/* numRegions */
-	24U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4764U,	/* fwlId */
-	16U,	/* numRegions */
-	16U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4765U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4766U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6148U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6156U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6176U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6240U,	/* fwlId */
-	7U,	/* numRegions */
-	7U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6248U,	/* fwlId */
-	6U,	/* numRegions */
-	6U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6249U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6250U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6251U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6252U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6253U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6254U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6260U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6268U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6269U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6270U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6288U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4128U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4224U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4320U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4368U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4612U,	/* fwlId */
-	12U,	/* numRegions */
-	12U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4628U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4636U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4644U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4652U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4660U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4672U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4684U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4696U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6146U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6152U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6160U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6208U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6244U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6256U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6264U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6272U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-}
+/* Firewall directory : {fwlId, regionOffset, numRegions, maxNumRegions} */
+SafetyCheckers_TifsFwlDirEntry gSafetyCheckers_TifsFwlDir[TIFS_CHECKER_FWL_MAX_NUM] = {
+	{257U, 0U, 16U, 16U},
+	{1U, 16U, 1U, 1U},
+	{3U, 17U, 1U, 1U},
+	{5U, 18U, 1U, 1U},
+	{6U, 19U, 1U, 1U},
+	{8U, 20U, 26U, 26U},
+	{9U, 46U, 16U, 16U},
+	{16U, 62U, 1U, 1U},
+	{24U, 63U, 1U, 1U},
+	{25U, 64U, 1U, 1U},
+	{64U, 65U, 1U, 1U},
+	{65U, 66U, 1U, 1U},
+	{66U, 67U, 1U, 1U},
+	{67U, 68U, 1U, 1U},
+	{68U, 69U, 1U, 1U},
+	{69U, 70U, 1U, 1U},
+	{70U, 71U, 1U, 1U},
+	{82U, 72U, 1U, 1U},
+	{84U, 73U, 1U, 1U},
+	{86U, 74U, 1U, 1U},
+	{96U, 75U, 1U, 1U},
+	{97U, 76U, 1U, 1U},
+	{98U, 77U, 4U, 4U},
+	{99U, 81U, 1U, 1U},
+	{100U, 82U, 1U, 1U},
+	{101U, 83U, 1U, 1U},
+	{102U, 84U, 1U, 1U},
+	{104U, 85U, 1U, 1U},
+	{105U, 86U, 1U, 1U},
+	{106U, 87U, 1U, 1U},
+	{107U, 88U, 1U, 1U},
+	{108U, 89U, 1U, 1U},
+	{114U, 90U, 1U, 1U},
+	{115U, 91U, 1U, 1U},
+	{116U, 92U, 1U, 1U},
+	{129U, 93U, 1U, 1U},
+	{130U, 94U, 1U, 1U},
+	{131U, 95U, 16U, 16U},
+	{132U, 111U, 1U, 1U},
+	{133U, 112U, 1U, 1U},
+	{135U, 113U, 3U, 3U},
+	{136U, 116U, 1U, 1U},
+	{137U, 117U, 1U, 1U},
+	{144U, 118U, 1U, 1U},
+	{160U, 119U, 1U, 1U},
+	{168U, 120U, 1U, 1U},
+	{176U, 121U, 1U, 1U},
+	{177U, 122U, 1U, 1U},
+	{178U, 123U, 1U, 1U},
+	{179U, 124U, 1U, 1U},
+	{1025U, 125U, 3U, 3U},
+	{1026U, 128U, 1U, 1U},
+	{1028U, 129U, 4U, 4U},
+	{1029U, 133U, 1U, 1U},
+	{1030U, 134U, 1U, 1U},
+	{1032U, 135U, 12U, 12U},
+	{1033U, 147U, 8U, 8U},
+	{1036U, 155U, 8U, 8U},
+	{1048U, 163U, 1U, 1U},
+	{1050U, 164U, 8U, 8U},
+	{1051U, 172U, 1U, 1U},
+	{1052U, 173U, 1U, 1U},
+	{1056U, 174U, 1U, 1U},
+	{1057U, 175U, 1U, 1U},
+	{1058U, 176U, 1U, 1U},
+	{1059U, 177U, 1U, 1U},
+	{1060U, 178U, 1U, 1U},
+	{1061U, 179U, 1U, 1U},
+	{1062U, 180U, 1U, 1U},
+	{1063U, 181U, 1U, 1U},
+	{1064U, 182U, 1U, 1U},
+	{1065U, 183U, 1U, 1U},
+	{1072U, 184U, 1U, 1U},
+	{1073U, 185U, 1U, 1U},
+	{1074U, 186U, 1U, 1U},
+	{1088U, 187U, 1U, 1U},
+	{1089U, 188U, 1U, 1U},
+	{1090U, 189U, 1U, 1U},
+	{1104U, 190U, 1U, 1U},
+	{1105U, 191U, 2U, 2U},
+	{1106U, 193U, 1U, 1U},
+	{1107U, 194U, 2U, 2U},
+	{1120U, 196U, 1U, 1U},
+	{1152U, 197U, 1U, 1U},
+	{1153U, 198U, 1U, 1U},
+	{1160U, 199U, 4U, 4U},
+	{1161U, 203U, 4U, 4U},
+	{1168U, 207U, 1U, 1U},
+	{1184U, 208U, 4U, 4U},
+	{1185U, 212U, 4U, 4U},
+	{1196U, 216U, 5U, 5U},
+	{1200U, 221U, 8U, 8U},
+	{1201U, 229U, 3U, 3U},
+	{1208U, 232U, 1U, 1U},
+	{1212U, 233U, 1U, 1U},
+	{1213U, 234U, 1U, 1U},
+	{1220U, 235U, 2U, 2U},
+	{1244U, 237U, 1U, 1U},
+	{1245U, 238U, 1U, 1U},
+	{1246U, 239U, 1U, 1U},
+	{1253U, 240U, 1U, 1U},
+	{1268U, 241U, 1U, 1U},
+	{1269U, 242U, 1U, 1U},
+	{1270U, 243U, 1U, 1U},
+	{1274U, 244U, 1U, 1U},
+	{1275U, 245U, 1U, 1U},
+	{2072U, 246U, 1U, 1U},
+	{2073U, 247U, 1U, 1U},
+	{2074U, 248U, 1U, 1U},
+	{2075U, 249U, 1U, 1U},
+	{2094U, 250U, 1U, 1U},
+	{2095U, 251U, 1U, 1U},
+	{2115U, 252U, 1U, 1U},
+	{2116U, 253U, 1U, 1U},
+	{2117U, 254U, 1U, 1U},
+	{2118U, 255U, 1U, 1U},
+	{2119U, 256U, 1U, 1U},
+	{2136U, 257U, 1U, 1U},
+	{2137U, 258U, 1U, 1U},
+	{2138U, 259U, 1U, 1U},
+	{2139U, 260U, 1U, 1U},
+	{2148U, 261U, 1U, 1U},
+	{2149U, 262U, 1U, 1U},
+	{2152U, 263U, 1U, 1U},
+	{2153U, 264U, 1U, 1U},
+	{2154U, 265U, 1U, 1U},
+	{2155U, 266U, 1U, 1U},
+	{2156U, 267U, 1U, 1U},
+	{2157U, 268U, 1U, 1U},
+	{2158U, 269U, 4U, 4U},
+	{2159U, 273U, 4U, 4U},
+	{2160U, 277U, 4U, 4U},
+	{2161U, 281U, 4U, 4U},
+	{2162U, 285U, 4U, 4U},
+	{2163U, 289U, 4U, 4U},
+	{2164U, 293U, 4U, 4U},
+	{2165U, 297U, 4U, 4U},
+	{2166U, 301U, 4U, 4U},
+	{2167U, 305U, 4U, 4U},
+	{2168U, 309U, 4U, 4U},
+	{2169U, 313U, 4U, 4U},
+	{2170U, 317U, 4U, 4U},
+	{2171U, 321U, 4U, 4U},
+	{2172U, 325U, 4U, 4U},
+	{2173U, 329U, 4U, 4U},
+	{2174U, 333U, 4U, 4U},
+	{2175U, 337U, 4U, 4U},
+	{2176U, 341U, 1U, 1U},
+	{2177U, 342U, 1U, 1U},
+	{2178U, 343U, 1U, 1U},
+	{2179U, 344U, 1U, 1U},
+	{2180U, 345U, 1U, 1U},
+	{2181U, 346U, 1U, 1U},
+	{2182U, 347U, 1U, 1U},
+	{2183U, 348U, 1U, 1U},
+	{2184U, 349U, 1U, 1U},
+	{2185U, 350U, 1U, 1U},
+	{2186U, 351U, 1U, 1U},
+	{2187U, 352U, 1U, 1U},
+	{2192U, 353U, 1U, 1U},
+	{2193U, 354U, 1U, 1U},
+	{2194U, 355U, 1U, 1U},
+	{2196U, 356U, 1U, 1U},
+	{2197U, 357U, 1U, 1U},
+	{2198U, 358U, 1U, 1U},
+	{2204U, 359U, 1U, 1U},
+	{2205U, 360U, 1U, 1U},
+	{2206U, 361U, 1U, 1U},
+	{2208U, 362U, 1U, 1U},
+	{2210U, 363U, 4U, 4U},
+	{2214U, 367U, 1U, 1U},
+	{2215U, 368U, 1U, 1U},
+	{2231U, 369U, 1U, 1U},
+	{2232U, 370U, 1U, 1U},
+	{2233U, 371U, 1U, 1U},
+	{2236U, 372U, 1U, 1U},
+	{2240U, 373U, 1U, 1U},
+	{2241U, 374U, 1U, 1U},
+	{2242U, 375U, 1U, 1U},
+	{2243U, 376U, 1U, 1U},
+	{2248U, 377U, 1U, 1U},
+	{2249U, 378U, 1U, 1U},
+	{2250U, 379U, 1U, 1U},
+	{2251U, 380U, 1U, 1U},
+	{2252U, 381U, 1U, 1U},
+	{2253U, 382U, 1U, 1U},
+	{2254U, 383U, 1U, 1U},
+	{2255U, 384U, 1U, 1U},
+	{2256U, 385U, 1U, 1U},
+	{2257U, 386U, 1U, 1U},
+	{2258U, 387U, 1U, 1U},
+	{2259U, 388U, 1U, 1U},
+	{2268U, 389U, 1U, 1U},
+	{2269U, 390U, 1U, 1U},
+	{2270U, 391U, 1U, 1U},
+	{2271U, 392U, 1U, 1U},
+	{2278U, 393U, 1U, 1U},
+	{2279U, 394U, 1U, 1U},
+	{2300U, 395U, 1U, 1U},
+	{2301U, 396U, 1U, 1U},
+	{2302U, 397U, 1U, 1U},
+	{2303U, 398U, 1U, 1U},
+	{2310U, 399U, 8U, 8U},
+	{2314U, 407U, 1U, 1U},
+	{2315U, 408U, 1U, 1U},
+	{2316U, 409U, 1U, 1U},
+	{2369U, 410U, 1U, 1U},
+	{2376U, 411U, 4U, 4U},
+	{2380U, 415U, 4U, 4U},
+	{2384U, 419U, 1U, 1U},
+	{2390U, 420U, 2U, 2U},
+	{2398U, 422U, 5U, 5U},
+	{2400U, 427U, 16U, 16U},
+	{2408U, 443U, 1U, 1U},
+	{2409U, 444U, 1U, 1U},
+	{2415U, 445U, 1U, 1U},
+	{2430U, 446U, 1U, 1U},
+	{2431U, 447U, 1U, 1U},
+	{2464U, 448U, 2U, 2U},
+	{2465U, 450U, 1U, 1U},
+	{2468U, 451U, 1U, 1U},
+	{2494U, 452U, 1U, 1U},
+	{2495U, 453U, 1U, 1U},
+	{2547U, 454U, 24U, 24U},
+	{2561U, 478U, 7U, 7U},
+	{2564U, 485U, 4U, 4U},
+	{2565U, 489U, 1U, 1U},
+	{2583U, 490U, 1U, 1U},
+	{2584U, 491U, 1U, 1U},
+	{2589U, 492U, 1U, 1U},
+	{2591U, 493U, 1U, 1U},
+	{2592U, 494U, 1U, 1U},
+	{2593U, 495U, 1U, 1U},
+	{2594U, 496U, 1U, 1U},
+	{2595U, 497U, 1U, 1U},
+	{2596U, 498U, 1U, 1U},
+	{2597U, 499U, 1U, 1U},
+	{2607U, 500U, 1U, 1U},
+	{2756U, 501U, 8U, 8U},
+	{2768U, 509U, 4U, 4U},
+	{2769U, 513U, 4U, 4U},
+	{2770U, 517U, 1U, 1U},
+	{2771U, 518U, 1U, 1U},
+	{2772U, 519U, 3U, 3U},
+	{2773U, 522U, 1U, 1U},
+	{2777U, 523U, 1U, 1U},
+	{2778U, 524U, 1U, 1U},
+	{2779U, 525U, 1U, 1U},
+	{2780U, 526U, 1U, 1U},
+	{4160U, 527U, 1U, 1U},
+	{4161U, 528U, 1U, 1U},
+	{4288U, 529U, 4U, 4U},
+	{4352U, 533U, 7U, 7U},
+	{4384U, 540U, 6U, 6U},
+	{4385U, 546U, 1U, 1U},
+	{4386U, 547U, 1U, 1U},
+	{4387U, 548U, 1U, 1U},
+	{4608U, 549U, 1U, 1U},
+	{4609U, 550U, 1U, 1U},
+	{4610U, 551U, 1U, 1U},
+	{4611U, 552U, 1U, 1U},
+	{4624U, 553U, 12U, 12U},
+	{4632U, 565U, 3U, 3U},
+	{4640U, 568U, 3U, 3U},
+	{4648U, 571U, 3U, 3U},
+	{4656U, 574U, 3U, 3U},
+	{4664U, 577U, 3U, 3U},
+	{4680U, 580U, 3U, 3U},
+	{4681U, 583U, 1U, 1U},
+	{4682U, 584U, 1U, 1U},
+	{4683U, 585U, 1U, 1U},
+	{4688U, 586U, 1U, 1U},
+	{4704U, 587U, 1U, 1U},
+	{4744U, 588U, 2U, 2U},
+	{4745U, 590U, 2U, 2U},
+	{4753U, 592U, 1U, 1U},
+	{4760U, 593U, 24U, 24U},
+	{4761U, 617U, 24U, 24U},
+	{4762U, 641U, 24U, 24U},
+	{4763U, 665U, 24U, 24U},
+	{4764U, 689U, 16U, 16U},
+	{4765U, 705U, 1U, 1U},
+	{4766U, 706U, 1U, 1U},
+	{6148U, 707U, 3U, 3U},
+	{6156U, 710U, 3U, 3U},
+	{6176U, 713U, 4U, 4U},
+	{6240U, 717U, 7U, 7U},
+	{6248U, 724U, 6U, 6U},
+	{6249U, 730U, 1U, 1U},
+	{6250U, 731U, 1U, 1U},
+	{6251U, 732U, 1U, 1U},
+	{6252U, 733U, 1U, 1U},
+	{6253U, 734U, 1U, 1U},
+	{6254U, 735U, 1U, 1U},
+	{6260U, 736U, 1U, 1U},
+	{6268U, 737U, 1U, 1U},
+	{6269U, 738U, 1U, 1U},
+	{6270U, 739U, 1U, 1U},
+	{6288U, 740U, 1U, 1U},
+	{4128U, 741U, 1U, 1U},
+	{4224U, 742U, 2U, 2U},
+	{4320U, 744U, 2U, 2U},
+	{4368U, 746U, 2U, 2U},
+	{4612U, 748U, 12U, 12U},
+	{4628U, 760U, 1U, 1U},
+	{4636U, 761U, 1U, 1U},
+	{4644U, 762U, 1U, 1U},
+	{4652U, 763U, 1U, 1U},
+	{4660U, 764U, 1U, 1U},
+	{4672U, 765U, 1U, 1U},
+	{4684U, 766U, 1U, 1U},
+	{4696U, 767U, 1U, 1U},
+	{6146U, 768U, 1U, 1U},
+	{6152U, 769U, 1U, 1U},
+	{6160U, 770U, 2U, 2U},
+	{6208U, 772U, 2U, 2U},
+	{6244U, 774U, 2U, 2U},
+	{6256U, 776U, 1U, 1U},
+	{6264U, 777U, 1U, 1U},
+	{6272U, 778U, 1U, 1U}
+};
+
+/* Firewall registers of every region to be populated with register values :
+ * {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
+SafetyCheckers_TifsFwlRegList gSafetyCheckers_TifsFwlRegions[TIFS_CHECKER_FWL_REGION_NUM];
+
+/* Packed firewall configuration */
+SafetyCheckers_TifsFwlPackedConfig gSafetyCheckers_TifsFwlPackedConfig = {
+	gSafetyCheckers_TifsFwlDir,	/* fwlDir */
+	TIFS_CHECKER_FWL_MAX_NUM,	/* numFwl */
+	gSafetyCheckers_TifsFwlRegions,	/* fwlRegions */
+	TIFS_CHECKER_FWL_REGION_NUM	/* numRegions */
 };
 
 #ifdef __cplusplus
@@ -52,7 +52,8 @@ extern "C" {
 /*                           Macros & Typedefs                                */
 /* ========================================================================== */
 
-/* None */
+/* Number of regions of the shared firewall region array */
+#define TIFS_CHECKER_FWL_REGION_NUM                               (1331U)
 
 /* ========================================================================== */
 /*                         Structure Declarations                             */
@@ -64,4503 +65,472 @@ extern "C" {
 /*                            Global Variables                                */
 /* ========================================================================== */
 
-/* Static firewall configuration to be populated with register values */ 
-SafetyCheckers_TifsFwlConfig gSafetyCheckers_TifsFwlConfig[TIFS_CHECKER_FWL_MAX_NUM] = {
-{
-	257U,	/* fwlId */
-	16U,	/* numRegions */
-	16U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	265U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	284U,	/* fwlId */
-	16U,	/* numRegions */
-	16U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	5U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	7U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	8U,	/* fwlId */
-	16U,	/* numRegions */
-	16U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	9U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	10U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	11U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	12U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	16U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	17U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	18U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	19U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	20U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	21U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	22U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	23U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	24U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	32U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	33U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	34U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	35U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	36U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	37U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	38U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	39U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	40U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	41U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	42U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	43U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	44U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	56U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	57U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	58U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	59U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	60U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	62U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	63U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	64U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	65U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	73U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	74U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	81U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	84U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	85U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	129U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	130U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	131U,	/* fwlId */
-	16U,	/* numRegions */
-	16U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	132U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	133U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	135U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	136U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	137U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	144U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	160U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	168U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	176U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	177U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	178U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	179U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	264U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	288U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1025U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1026U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1028U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1029U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1030U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1032U,	/* fwlId */
-	12U,	/* numRegions */
-	12U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1033U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1036U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1048U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1050U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1051U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1052U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1056U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1057U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1058U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1059U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1060U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1061U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1062U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1063U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1064U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1065U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1072U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1073U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1074U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1088U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1089U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1090U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1104U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1105U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1106U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1107U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1120U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1152U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1153U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1160U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1161U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1168U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1184U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1185U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1196U,	/* fwlId */
-	5U,	/* numRegions */
-	5U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1200U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1201U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1208U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1212U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1213U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1220U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1244U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1245U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1246U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1253U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1268U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1269U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1270U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	1280U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2048U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2049U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2050U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2051U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2052U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2053U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2054U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2055U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2056U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2057U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2058U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2059U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2064U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2065U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2066U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2068U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2069U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2070U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2072U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2073U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2074U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2075U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2076U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2077U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2078U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2080U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2082U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2086U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2087U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2094U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2095U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2096U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2097U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2100U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2104U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2105U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2108U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2112U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2113U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2114U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2115U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2116U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2117U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2118U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2119U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2120U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2121U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2122U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2123U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2124U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2125U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2126U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2127U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2128U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2129U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2130U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2131U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2136U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2137U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2138U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2139U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2140U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2141U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2142U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2143U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2148U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2149U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2150U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2151U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2152U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2153U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2154U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2155U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2156U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2157U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2160U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2161U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2162U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2163U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2164U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2165U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2166U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2167U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2168U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2169U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2170U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2171U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2172U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2173U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2176U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2184U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2185U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2303U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2304U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2305U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2308U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2310U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2312U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2314U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2315U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2316U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2317U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2368U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2369U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2370U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2371U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2376U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2377U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2380U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2381U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2384U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2386U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2387U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2390U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2392U,	/* fwlId */
-	5U,	/* numRegions */
-	5U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2394U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2395U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2398U,	/* fwlId */
-	7U,	/* numRegions */
-	7U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2400U,	/* fwlId */
-	16U,	/* numRegions */
-	16U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2402U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2408U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2409U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2410U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2411U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2412U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2413U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2415U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2416U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2418U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2419U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2430U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2431U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2432U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2433U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2436U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2437U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2440U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2442U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2446U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2463U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2464U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2465U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2466U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2467U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2468U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2469U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2470U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2472U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2494U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2495U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2496U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2497U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2498U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2499U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2500U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2501U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2502U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2503U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2504U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2505U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2506U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2507U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2508U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2509U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2510U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2511U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2512U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2513U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2527U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2528U,	/* fwlId */
-	24U,	/* numRegions */
-	24U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2529U,	/* fwlId */
-	24U,	/* numRegions */
-	24U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2530U,	/* fwlId */
-	24U,	/* numRegions */
-	24U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2531U,	/* fwlId */
-	24U,	/* numRegions */
-	24U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2532U,	/* fwlId */
-	24U,	/* numRegions */
-	24U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2533U,	/* fwlId */
-	24U,	/* numRegions */
-	24U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2534U,	/* fwlId */
-	24U,	/* numRegions */
-	24U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2535U,	/* fwlId */
-	24U,	/* numRegions */
-	24U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2560U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2561U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2562U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2563U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2568U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2569U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2570U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2571U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2576U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2578U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2580U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2583U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2584U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2585U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2586U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2587U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2588U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2589U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2590U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2591U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2592U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2593U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2594U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2595U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2596U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2597U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2606U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2607U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2608U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2609U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2623U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2696U,	/* fwlId */
-	36U,	/* numRegions */
-	36U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2698U,	/* fwlId */
-	12U,	/* numRegions */
-	12U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2700U,	/* fwlId */
-	17U,	/* numRegions */
-	17U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2704U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2706U,	/* fwlId */
-	6U,	/* numRegions */
-	6U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2710U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2728U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2729U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2732U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2733U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2734U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2735U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2736U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2738U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2750U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	2751U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4160U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4161U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4288U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4352U,	/* fwlId */
-	7U,	/* numRegions */
-	7U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4384U,	/* fwlId */
-	6U,	/* numRegions */
-	6U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4385U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4386U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4387U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4388U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4389U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4608U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4609U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4610U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4611U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4624U,	/* fwlId */
-	12U,	/* numRegions */
-	12U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4632U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4640U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4648U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4656U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4664U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4680U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4681U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4682U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4683U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4688U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4704U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4736U,	/* fwlId */
-	6U,	/* numRegions */
-	6U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4737U,	/* fwlId */
-	6U,	/* numRegions */
-	6U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4738U,	/* fwlId */
-	6U,	/* numRegions */
-	6U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4739U,	/* fwlId */
-	6U,	/* numRegions */
-	6U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4740U,	/* fwlId */
-	6U,	/* numRegions */
-	6U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4744U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4745U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4747U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4752U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4753U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4760U,	/* fwlId */
-	24U,	/* numRegions */
-	24U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4761U,	/* fwlId */
-	24U,	/* numRegions */
-	24U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4762U,	/* fwlId */
-	24U,	/* numRegions */
-	24U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4763U,	/* fwlId */
-	24U,	/* numRegions */
-	24U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	5984U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	5985U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	5986U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	5987U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	5988U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	5989U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	5990U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	5991U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	5992U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	5993U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6016U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6017U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6018U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6019U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6048U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6049U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6050U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6051U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6052U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6053U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6055U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6057U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6058U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6059U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6060U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6080U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6081U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6082U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6083U,	/* fwlId */
-	8U,	/* numRegions */
-	8U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6148U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6156U,	/* fwlId */
-	3U,	/* numRegions */
-	3U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6176U,	/* fwlId */
-	4U,	/* numRegions */
-	4U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6240U,	/* fwlId */
-	7U,	/* numRegions */
-	7U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6248U,	/* fwlId */
-	6U,	/* numRegions */
-	6U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6249U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6250U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6251U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6252U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6253U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6254U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6260U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6268U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6269U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6270U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6288U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	304U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4128U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4224U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4320U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4368U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4612U,	/* fwlId */
-	12U,	/* numRegions */
-	12U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4628U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4636U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4644U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4652U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4660U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4672U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4684U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	4696U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6146U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6152U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6160U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6208U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6244U,	/* fwlId */
-	2U,	/* numRegions */
-	2U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6256U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6264U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-},
-{
-	6272U,	/* fwlId */
-	1U,	/* numRegions */
-	1U,	/* maxNumRegions */
-	{ 	/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
-		{0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U},
-	},
-}
+/* Firewall directory : {fwlId, regionOffset, numRegions, maxNumRegions} */
+SafetyCheckers_TifsFwlDirEntry gSafetyCheckers_TifsFwlDir[TIFS_CHECKER_FWL_MAX_NUM] = {
+	{257U, 0U, 16U, 16U},
+	{265U, 16U, 8U, 8U},
+	{284U, 24U, 16U, 16U},
+	{1U, 40U, 1U, 1U},
+	{2U, 41U, 1U, 1U},
+	{5U, 42U, 1U, 1U},
+	{6U, 43U, 1U, 1U},
+	{7U, 44U, 4U, 4U},
+	{8U, 48U, 16U, 16U},
+	{9U, 64U, 8U, 8U},
+	{10U, 72U, 1U, 1U},
+	{11U, 73U, 1U, 1U},
+	{12U, 74U, 1U, 1U},
+	{16U, 75U, 1U, 1U},
+	{17U, 76U, 1U, 1U},
+	{18U, 77U, 1U, 1U},
+	{19U, 78U, 1U, 1U},
+	{20U, 79U, 1U, 1U},
+	{21U, 80U, 1U, 1U},
+	{22U, 81U, 1U, 1U},
+	{23U, 82U, 1U, 1U},
+	{24U, 83U, 1U, 1U},
+	{32U, 84U, 1U, 1U},
+	{33U, 85U, 1U, 1U},
+	{34U, 86U, 1U, 1U},
+	{35U, 87U, 1U, 1U},
+	{36U, 88U, 1U, 1U},
+	{37U, 89U, 1U, 1U},
+	{38U, 90U, 1U, 1U},
+	{39U, 91U, 1U, 1U},
+	{40U, 92U, 1U, 1U},
+	{41U, 93U, 1U, 1U},
+	{42U, 94U, 1U, 1U},
+	{43U, 95U, 1U, 1U},
+	{44U, 96U, 1U, 1U},
+	{56U, 97U, 1U, 1U},
+	{57U, 98U, 1U, 1U},
+	{58U, 99U, 1U, 1U},
+	{59U, 100U, 1U, 1U},
+	{60U, 101U, 1U, 1U},
+	{62U, 102U, 1U, 1U},
+	{63U, 103U, 1U, 1U},
+	{64U, 104U, 1U, 1U},
+	{65U, 105U, 1U, 1U},
+	{73U, 106U, 1U, 1U},
+	{74U, 107U, 1U, 1U},
+	{81U, 108U, 1U, 1U},
+	{84U, 109U, 1U, 1U},
+	{85U, 110U, 1U, 1U},
+	{129U, 111U, 1U, 1U},
+	{130U, 112U, 1U, 1U},
+	{131U, 113U, 16U, 16U},
+	{132U, 129U, 1U, 1U},
+	{133U, 130U, 1U, 1U},
+	{135U, 131U, 3U, 3U},
+	{136U, 134U, 1U, 1U},
+	{137U, 135U, 1U, 1U},
+	{144U, 136U, 1U, 1U},
+	{160U, 137U, 1U, 1U},
+	{168U, 138U, 1U, 1U},
+	{176U, 139U, 1U, 1U},
+	{177U, 140U, 1U, 1U},
+	{178U, 141U, 1U, 1U},
+	{179U, 142U, 1U, 1U},
+	{264U, 143U, 2U, 2U},
+	{288U, 145U, 3U, 3U},
+	{1025U, 148U, 2U, 2U},
+	{1026U, 150U, 1U, 1U},
+	{1028U, 151U, 4U, 4U},
+	{1029U, 155U, 1U, 1U},
+	{1030U, 156U, 1U, 1U},
+	{1032U, 157U, 12U, 12U},
+	{1033U, 169U, 8U, 8U},
+	{1036U, 177U, 8U, 8U},
+	{1048U, 185U, 1U, 1U},
+	{1050U, 186U, 8U, 8U},
+	{1051U, 194U, 1U, 1U},
+	{1052U, 195U, 1U, 1U},
+	{1056U, 196U, 1U, 1U},
+	{1057U, 197U, 1U, 1U},
+	{1058U, 198U, 1U, 1U},
+	{1059U, 199U, 1U, 1U},
+	{1060U, 200U, 1U, 1U},
+	{1061U, 201U, 1U, 1U},
+	{1062U, 202U, 1U, 1U},
+	{1063U, 203U, 1U, 1U},
+	{1064U, 204U, 1U, 1U},
+	{1065U, 205U, 1U, 1U},
+	{1072U, 206U, 1U, 1U},
+	{1073U, 207U, 1U, 1U},
+	{1074U, 208U, 1U, 1U},
+	{1088U, 209U, 1U, 1U},
+	{1089U, 210U, 1U, 1U},
+	{1090U, 211U, 1U, 1U},
+	{1104U, 212U, 1U, 1U},
+	{1105U, 213U, 2U, 2U},
+	{1106U, 215U, 1U, 1U},
+	{1107U, 216U, 2U, 2U},
+	{1120U, 218U, 1U, 1U},
+	{1152U, 219U, 1U, 1U},
+	{1153U, 220U, 1U, 1U},
+	{1160U, 221U, 4U, 4U},
+	{1161U, 225U, 4U, 4U},
+	{1168U, 229U, 1U, 1U},
+	{1184U, 230U, 4U, 4U},
+	{1185U, 234U, 4U, 4U},
+	{1196U, 238U, 5U, 5U},
+	{1200U, 243U, 8U, 8U},
+	{1201U, 251U, 3U, 3U},
+	{1208U, 254U, 1U, 1U},
+	{1212U, 255U, 1U, 1U},
+	{1213U, 256U, 1U, 1U},
+	{1220U, 257U, 2U, 2U},
+	{1244U, 259U, 1U, 1U},
+	{1245U, 260U, 1U, 1U},
+	{1246U, 261U, 1U, 1U},
+	{1253U, 262U, 1U, 1U},
+	{1268U, 263U, 1U, 1U},
+	{1269U, 264U, 1U, 1U},
+	{1270U, 265U, 1U, 1U},
+	{1280U, 266U, 8U, 8U},
+	{2048U, 274U, 1U, 1U},
+	{2049U, 275U, 1U, 1U},
+	{2050U, 276U, 1U, 1U},
+	{2051U, 277U, 1U, 1U},
+	{2052U, 278U, 1U, 1U},
+	{2053U, 279U, 1U, 1U},
+	{2054U, 280U, 1U, 1U},
+	{2055U, 281U, 1U, 1U},
+	{2056U, 282U, 1U, 1U},
+	{2057U, 283U, 1U, 1U},
+	{2058U, 284U, 1U, 1U},
+	{2059U, 285U, 1U, 1U},
+	{2064U, 286U, 1U, 1U},
+	{2065U, 287U, 1U, 1U},
+	{2066U, 288U, 1U, 1U},
+	{2068U, 289U, 1U, 1U},
+	{2069U, 290U, 1U, 1U},
+	{2070U, 291U, 1U, 1U},
+	{2072U, 292U, 1U, 1U},
+	{2073U, 293U, 1U, 1U},
+	{2074U, 294U, 1U, 1U},
+	{2075U, 295U, 1U, 1U},
+	{2076U, 296U, 1U, 1U},
+	{2077U, 297U, 1U, 1U},
+	{2078U, 298U, 1U, 1U},
+	{2080U, 299U, 1U, 1U},
+	{2082U, 300U, 4U, 4U},
+	{2086U, 304U, 1U, 1U},
+	{2087U, 305U, 1U, 1U},
+	{2094U, 306U, 1U, 1U},
+	{2095U, 307U, 1U, 1U},
+	{2096U, 308U, 1U, 1U},
+	{2097U, 309U, 1U, 1U},
+	{2100U, 310U, 1U, 1U},
+	{2104U, 311U, 1U, 1U},
+	{2105U, 312U, 1U, 1U},
+	{2108U, 313U, 1U, 1U},
+	{2112U, 314U, 1U, 1U},
+	{2113U, 315U, 1U, 1U},
+	{2114U, 316U, 1U, 1U},
+	{2115U, 317U, 1U, 1U},
+	{2116U, 318U, 1U, 1U},
+	{2117U, 319U, 1U, 1U},
+	{2118U, 320U, 1U, 1U},
+	{2119U, 321U, 1U, 1U},
+	{2120U, 322U, 1U, 1U},
+	{2121U, 323U, 1U, 1U},
+	{2122U, 324U, 1U, 1U},
+	{2123U, 325U, 1U, 1U},
+	{2124U, 326U, 1U, 1U},
+	{2125U, 327U, 1U, 1U},
+	{2126U, 328U, 1U, 1U},
+	{2127U, 329U, 1U, 1U},
+	{2128U, 330U, 1U, 1U},
+	{2129U, 331U, 1U, 1U},
+	{2130U, 332U, 1U, 1U},
+	{2131U, 333U, 1U, 1U},
+	{2136U, 334U, 1U, 1U},
+	{2137U, 335U, 1U, 1U},
+	{2138U, 336U, 1U, 1U},
+	{2139U, 337U, 1U, 1U},
+	{2140U, 338U, 1U, 1U},
+	{2141U, 339U, 1U, 1U},
+	{2142U, 340U, 1U, 1U},
+	{2143U, 341U, 1U, 1U},
+	{2148U, 342U, 1U, 1U},
+	{2149U, 343U, 1U, 1U},
+	{2150U, 344U, 1U, 1U},
+	{2151U, 345U, 1U, 1U},
+	{2152U, 346U, 1U, 1U},
+	{2153U, 347U, 1U, 1U},
+	{2154U, 348U, 1U, 1U},
+	{2155U, 349U, 1U, 1U},
+	{2156U, 350U, 1U, 1U},
+	{2157U, 351U, 1U, 1U},
+	{2160U, 352U, 4U, 4U},
+	{2161U, 356U, 4U, 4U},
+	{2162U, 360U, 4U, 4U},
+	{2163U, 364U, 4U, 4U},
+	{2164U, 368U, 4U, 4U},
+	{2165U, 372U, 4U, 4U},
+	{2166U, 376U, 4U, 4U},
+	{2167U, 380U, 4U, 4U},
+	{2168U, 384U, 4U, 4U},
+	{2169U, 388U, 4U, 4U},
+	{2170U, 392U, 4U, 4U},
+	{2171U, 396U, 4U, 4U},
+	{2172U, 400U, 4U, 4U},
+	{2173U, 404U, 4U, 4U},
+	{2176U, 408U, 1U, 1U},
+	{2184U, 409U, 1U, 1U},
+	{2185U, 410U, 1U, 1U},
+	{2303U, 411U, 1U, 1U},
+	{2304U, 412U, 8U, 8U},
+	{2305U, 420U, 8U, 8U},
+	{2308U, 428U, 8U, 8U},
+	{2310U, 436U, 8U, 8U},
+	{2312U, 444U, 8U, 8U},
+	{2314U, 452U, 4U, 4U},
+	{2315U, 456U, 4U, 4U},
+	{2316U, 460U, 4U, 4U},
+	{2317U, 464U, 4U, 4U},
+	{2368U, 468U, 2U, 2U},
+	{2369U, 470U, 1U, 1U},
+	{2370U, 471U, 2U, 2U},
+	{2371U, 473U, 1U, 1U},
+	{2376U, 474U, 1U, 1U},
+	{2377U, 475U, 1U, 1U},
+	{2380U, 476U, 4U, 4U},
+	{2381U, 480U, 4U, 4U},
+	{2384U, 484U, 1U, 1U},
+	{2386U, 485U, 8U, 8U},
+	{2387U, 493U, 8U, 8U},
+	{2390U, 501U, 2U, 2U},
+	{2392U, 503U, 5U, 5U},
+	{2394U, 508U, 1U, 1U},
+	{2395U, 509U, 1U, 1U},
+	{2398U, 510U, 7U, 7U},
+	{2400U, 517U, 16U, 16U},
+	{2402U, 533U, 1U, 1U},
+	{2408U, 534U, 1U, 1U},
+	{2409U, 535U, 1U, 1U},
+	{2410U, 536U, 1U, 1U},
+	{2411U, 537U, 1U, 1U},
+	{2412U, 538U, 1U, 1U},
+	{2413U, 539U, 1U, 1U},
+	{2415U, 540U, 1U, 1U},
+	{2416U, 541U, 1U, 1U},
+	{2418U, 542U, 1U, 1U},
+	{2419U, 543U, 1U, 1U},
+	{2430U, 544U, 1U, 1U},
+	{2431U, 545U, 1U, 1U},
+	{2432U, 546U, 4U, 4U},
+	{2433U, 550U, 4U, 4U},
+	{2436U, 554U, 2U, 2U},
+	{2437U, 556U, 2U, 2U},
+	{2440U, 558U, 4U, 4U},
+	{2442U, 562U, 1U, 1U},
+	{2446U, 563U, 1U, 1U},
+	{2463U, 564U, 1U, 1U},
+	{2464U, 565U, 2U, 2U},
+	{2465U, 567U, 1U, 1U},
+	{2466U, 568U, 1U, 1U},
+	{2467U, 569U, 1U, 1U},
+	{2468U, 570U, 1U, 1U},
+	{2469U, 571U, 1U, 1U},
+	{2470U, 572U, 1U, 1U},
+	{2472U, 573U, 1U, 1U},
+	{2494U, 574U, 1U, 1U},
+	{2495U, 575U, 1U, 1U},
+	{2496U, 576U, 1U, 1U},
+	{2497U, 577U, 1U, 1U},
+	{2498U, 578U, 1U, 1U},
+	{2499U, 579U, 1U, 1U},
+	{2500U, 580U, 1U, 1U},
+	{2501U, 581U, 1U, 1U},
+	{2502U, 582U, 1U, 1U},
+	{2503U, 583U, 1U, 1U},
+	{2504U, 584U, 1U, 1U},
+	{2505U, 585U, 1U, 1U},
+	{2506U, 586U, 1U, 1U},
+	{2507U, 587U, 1U, 1U},
+	{2508U, 588U, 1U, 1U},
+	{2509U, 589U, 1U, 1U},
+	{2510U, 590U, 1U, 1U},
+	{2511U, 591U, 1U, 1U},
+	{2512U, 592U, 1U, 1U},
+	{2513U, 593U, 1U, 1U},
+	{2527U, 594U, 1U, 1U},
+	{2528U, 595U, 24U, 24U},
+	{2529U, 619U, 24U, 24U},
+	{2530U, 643U, 24U, 24U},
+	{2531U, 667U, 24U, 24U},
+	{2532U, 691U, 24U, 24U},
+	{2533U, 715U, 24U, 24U},
+	{2534U, 739U, 24U, 24U},
+	{2535U, 763U, 24U, 24U},
+	{2560U, 787U, 8U, 8U},
+	{2561U, 795U, 8U, 8U},
+	{2562U, 803U, 8U, 8U},
+	{2563U, 811U, 8U, 8U},
+	{2568U, 819U, 4U, 4U},
+	{2569U, 823U, 1U, 1U},
+	{2570U, 824U, 4U, 4U},
+	{2571U, 828U, 1U, 1U},
+	{2576U, 829U, 4U, 4U},
+	{2578U, 833U, 4U, 4U},
+	{2580U, 837U, 4U, 4U},
+	{2583U, 841U, 1U, 1U},
+	{2584U, 842U, 1U, 1U},
+	{2585U, 843U, 1U, 1U},
+	{2586U, 844U, 1U, 1U},
+	{2587U, 845U, 1U, 1U},
+	{2588U, 846U, 1U, 1U},
+	{2589U, 847U, 1U, 1U},
+	{2590U, 848U, 1U, 1U},
+	{2591U, 849U, 1U, 1U},
+	{2592U, 850U, 1U, 1U},
+	{2593U, 851U, 1U, 1U},
+	{2594U, 852U, 1U, 1U},
+	{2595U, 853U, 1U, 1U},
+	{2596U, 854U, 1U, 1U},
+	{2597U, 855U, 1U, 1U},
+	{2606U, 856U, 1U, 1U},
+	{2607U, 857U, 1U, 1U},
+	{2608U, 858U, 1U, 1U},
+	{2609U, 859U, 2U, 2U},
+	{2623U, 861U, 1U, 1U},
+	{2696U, 862U, 36U, 36U},
+	{2698U, 898U, 12U, 12U},
+	{2700U, 910U, 17U, 17U},
+	{2704U, 927U, 3U, 3U},
+	{2706U, 930U, 6U, 6U},
+	{2710U, 936U, 1U, 1U},
+	{2728U, 937U, 1U, 1U},
+	{2729U, 938U, 1U, 1U},
+	{2732U, 939U, 1U, 1U},
+	{2733U, 940U, 1U, 1U},
+	{2734U, 941U, 1U, 1U},
+	{2735U, 942U, 1U, 1U},
+	{2736U, 943U, 1U, 1U},
+	{2738U, 944U, 1U, 1U},
+	{2750U, 945U, 1U, 1U},
+	{2751U, 946U, 1U, 1U},
+	{4160U, 947U, 1U, 1U},
+	{4161U, 948U, 1U, 1U},
+	{4288U, 949U, 4U, 4U},
+	{4352U, 953U, 7U, 7U},
+	{4384U, 960U, 6U, 6U},
+	{4385U, 966U, 1U, 1U},
+	{4386U, 967U, 1U, 1U},
+	{4387U, 968U, 1U, 1U},
+	{4388U, 969U, 1U, 1U},
+	{4389U, 970U, 1U, 1U},
+	{4608U, 971U, 1U, 1U},
+	{4609U, 972U, 1U, 1U},
+	{4610U, 973U, 1U, 1U},
+	{4611U, 974U, 1U, 1U},
+	{4624U, 975U, 12U, 12U},
+	{4632U, 987U, 3U, 3U},
+	{4640U, 990U, 3U, 3U},
+	{4648U, 993U, 3U, 3U},
+	{4656U, 996U, 3U, 3U},
+	{4664U, 999U, 3U, 3U},
+	{4680U, 1002U, 3U, 3U},
+	{4681U, 1005U, 1U, 1U},
+	{4682U, 1006U, 1U, 1U},
+	{4683U, 1007U, 1U, 1U},
+	{4688U, 1008U, 1U, 1U},
+	{4704U, 1009U, 1U, 1U},
+	{4736U, 1010U, 6U, 6U},
+	{4737U, 1016U, 6U, 6U},
+	{4738U, 1022U, 6U, 6U},
+	{4739U, 1028U, 6U, 6U},
+	{4740U, 1034U, 6U, 6U},
+	{4744U, 1040U, 2U, 2U},
+	{4745U, 1042U, 2U, 2U},
+	{4747U, 1044U, 2U, 2U},
+	{4752U, 1046U, 1U, 1U},
+	{4753U, 1047U, 1U, 1U},
+	{4760U, 1048U, 24U, 24U},
+	{4761U, 1072U, 24U, 24U},
+	{4762U, 1096U, 24U, 24U},
+	{4763U, 1120U, 24U, 24U},
+	{5984U, 1144U, 1U, 1U},
+	{5985U, 1145U, 1U, 1U},
+	{5986U, 1146U, 4U, 4U},
+	{5987U, 1150U, 4U, 4U},
+	{5988U, 1154U, 1U, 1U},
+	{5989U, 1155U, 1U, 1U},
+	{5990U, 1156U, 1U, 1U},
+	{5991U, 1157U, 1U, 1U},
+	{5992U, 1158U, 1U, 1U},
+	{5993U, 1159U, 4U, 4U},
+	{6016U, 1163U, 4U, 4U},
+	{6017U, 1167U, 4U, 4U},
+	{6018U, 1171U, 4U, 4U},
+	{6019U, 1175U, 4U, 4U},
+	{6048U, 1179U, 2U, 2U},
+	{6049U, 1181U, 1U, 1U},
+	{6050U, 1182U, 8U, 8U},
+	{6051U, 1190U, 8U, 8U},
+	{6052U, 1198U, 1U, 1U},
+	{6053U, 1199U, 4U, 4U},
+	{6055U, 1203U, 4U, 4U},
+	{6057U, 1207U, 2U, 2U},
+	{6058U, 1209U, 1U, 1U},
+	{6059U, 1210U, 8U, 8U},
+	{6060U, 1218U, 8U, 8U},
+	{6080U, 1226U, 8U, 8U},
+	{6081U, 1234U, 8U, 8U},
+	{6082U, 1242U, 8U, 8U},
+	{6083U, 1250U, 8U, 8U},
+	{6148U, 1258U, 3U, 3U},
+	{6156U, 1261U, 3U, 3U},
+	{6176U, 1264U, 4U, 4U},
+	{6240U, 1268U, 7U, 7U},
+	{6248U, 1275U, 6U, 6U},
+	{6249U, 1281U, 1U, 1U},
+	{6250U, 1282U, 1U, 1U},
+	{6251U, 1283U, 1U, 1U},
+	{6252U, 1284U, 1U, 1U},
+	{6253U, 1285U, 1U, 1U},
+	{6254U, 1286U, 1U, 1U},
+	{6260U, 1287U, 1U, 1U},
+	{6268U, 1288U, 1U, 1U},
+	{6269U, 1289U, 1U, 1U},
+	{6270U, 1290U, 1U, 1U},
+	{6288U, 1291U, 1U, 1U},
+	{304U, 1292U, 1U, 1U},
+	{4128U, 1293U, 1U, 1U},
+	{4224U, 1294U, 2U, 2U},
+	{4320U, 1296U, 2U, 2U},
+	{4368U, 1298U, 2U, 2U},
+	{4612U, 1300U, 12U, 12U},
+	{4628U, 1312U, 1U, 1U},
+	{4636U, 1313U, 1U, 1U},
+	{4644U, 1314U, 1U, 1U},
+	{4652U, 1315U, 1U, 1U},
+	{4660U, 1316U, 1U, 1U},
+	{4672U, 1317U, 1U, 1U},
+	{4684U, 1318U, 1U, 1U},
+	{4696U, 1319U, 1U, 1U},
+	{6146U, 1320U, 1U, 1U},
+	{6152U, 1321U, 1U, 1U},
+	{6160U, 1322U, 2U, 2U},
+	{6208U, 1324U, 2U, 2U},
+	{6244U, 1326U, 2U, 2U},
+	{6256U, 1328U, 1U, 1U},
+	{6264U, 1329U, 1U, 1U},
+	{6272U, 1330U, 1U, 1U}
+};
+
+/* Firewall registers of every region to be populated with register values :
+ * {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */
+SafetyCheckers_TifsFwlRegList gSafetyCheckers_TifsFwlRegions[TIFS_CHECKER_FWL_REGION_NUM];
+
+/* Packed firewall configuration */
+SafetyCheckers_TifsFwlPackedConfig gSafetyCheckers_TifsFwlPackedConfig = {
+	gSafetyCheckers_TifsFwlDir,	/* fwlDir */
+	TIFS_CHECKER_FWL_MAX_NUM,	/* numFwl */
+	gSafetyCheckers_TifsFwlRegions,	/* fwlRegions */
+	TIFS_CHECKER_FWL_REGION_NUM	/* numRegions */
 };
 
 #ifdef __cplusplus
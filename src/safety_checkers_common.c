@@ -0,0 +1,929 @@
+/*
+ *  Copyright (C) 2024 Texas Instruments Incorporated
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/**
+ *  \file     safety_checkers_common.c
+ *
+ *  \brief    This file contains safety checkers common library functions
+ *
+ */
+
+/* ========================================================================== */
+/*                             Include Files                                  */
+/* ========================================================================== */
+
+#include <stdint.h>
+#include <string.h>
+#include <cslr.h>
+#include <safety_checkers_common.h>
+
+/* ========================================================================== */
+/*                           Macros & Typedefs                                */
+/* ========================================================================== */
+
+/* None */
+
+/* ========================================================================== */
+/*                         Structure Declarations                             */
+/* ========================================================================== */
+
+/* None */
+
+/* ========================================================================== */
+/*                          Function Declarations                             */
+/* ========================================================================== */
+
+static uint32_t SafetyCheckers_sigTreeLeafStart(uint32_t leaf, uint32_t totalReg);
+static int32_t SafetyCheckers_regSetCheckSnapshotArgs(const SafetyCheckers_RegSetTable *table,
+                                                      const uintptr_t *regCfg, uint32_t size,
+                                                      const SafetyCheckers_SnapshotOps *snapshotOps,
+                                                      const uint32_t *scratch, uint32_t scratchSize);
+static int32_t SafetyCheckers_regSetStartRun(const SafetyCheckers_SnapshotOps *snapshotOps,
+                                             const SafetyCheckers_RegSetRun *run, uint32_t *dst);
+static int32_t SafetyCheckers_regSetWaitRun(const SafetyCheckers_SnapshotOps *snapshotOps,
+                                            const SafetyCheckers_RegSetRun *run);
+static uint32_t SafetyCheckers_regSetCompareRun(const uintptr_t *regCfg, const uint32_t *snapshot,
+                                                const SafetyCheckers_RegSetRun *run);
+
+/* ========================================================================== */
+/*                            Global Variables                                */
+/* ========================================================================== */
+
+/**
+ * \brief Lookup table for the reflected CRC-64/XZ polynomial (0xC96C5795D7870F42)
+ *        used to build register signatures one byte at a time.
+ */
+static const uint64_t gSafetyCheckers_SigTable[256U] =
+{
+    0x0000000000000000ULL, 0xB32E4CBE03A75F6FULL,
+    0xF4843657A840A05BULL, 0x47AA7AE9ABE7FF34ULL,
+    0x7BD0C384FF8F5E33ULL, 0xC8FE8F3AFC28015CULL,
+    0x8F54F5D357CFFE68ULL, 0x3C7AB96D5468A107ULL,
+    0xF7A18709FF1EBC66ULL, 0x448FCBB7FCB9E309ULL,
+    0x0325B15E575E1C3DULL, 0xB00BFDE054F94352ULL,
+    0x8C71448D0091E255ULL, 0x3F5F08330336BD3AULL,
+    0x78F572DAA8D1420EULL, 0xCBDB3E64AB761D61ULL,
+    0x7D9BA13851336649ULL, 0xCEB5ED8652943926ULL,
+    0x891F976FF973C612ULL, 0x3A31DBD1FAD4997DULL,
+    0x064B62BCAEBC387AULL, 0xB5652E02AD1B6715ULL,
+    0xF2CF54EB06FC9821ULL, 0x41E11855055BC74EULL,
+    0x8A3A2631AE2DDA2FULL, 0x39146A8FAD8A8540ULL,
+    0x7EBE1066066D7A74ULL, 0xCD905CD805CA251BULL,
+    0xF1EAE5B551A2841CULL, 0x42C4A90B5205DB73ULL,
+    0x056ED3E2F9E22447ULL, 0xB6409F5CFA457B28ULL,
+    0xFB374270A266CC92ULL, 0x48190ECEA1C193FDULL,
+    0x0FB374270A266CC9ULL, 0xBC9D3899098133A6ULL,
+    0x80E781F45DE992A1ULL, 0x33C9CD4A5E4ECDCEULL,
+    0x7463B7A3F5A932FAULL, 0xC74DFB1DF60E6D95ULL,
+    0x0C96C5795D7870F4ULL, 0xBFB889C75EDF2F9BULL,
+    0xF812F32EF538D0AFULL, 0x4B3CBF90F69F8FC0ULL,
+    0x774606FDA2F72EC7ULL, 0xC4684A43A15071A8ULL,
+    0x83C230AA0AB78E9CULL, 0x30EC7C140910D1F3ULL,
+    0x86ACE348F355AADBULL, 0x3582AFF6F0F2F5B4ULL,
+    0x7228D51F5B150A80ULL, 0xC10699A158B255EFULL,
+    0xFD7C20CC0CDAF4E8ULL, 0x4E526C720F7DAB87ULL,
+    0x09F8169BA49A54B3ULL, 0xBAD65A25A73D0BDCULL,
+    0x710D64410C4B16BDULL, 0xC22328FF0FEC49D2ULL,
+    0x85895216A40BB6E6ULL, 0x36A71EA8A7ACE989ULL,
+    0x0ADDA7C5F3C4488EULL, 0xB9F3EB7BF06317E1ULL,
+    0xFE5991925B84E8D5ULL, 0x4D77DD2C5823B7BAULL,
+    0x64B62BCAEBC387A1ULL, 0xD7986774E864D8CEULL,
+    0x90321D9D438327FAULL, 0x231C512340247895ULL,
+    0x1F66E84E144CD992ULL, 0xAC48A4F017EB86FDULL,
+    0xEBE2DE19BC0C79C9ULL, 0x58CC92A7BFAB26A6ULL,
+    0x9317ACC314DD3BC7ULL, 0x2039E07D177A64A8ULL,
+    0x67939A94BC9D9B9CULL, 0xD4BDD62ABF3AC4F3ULL,
+    0xE8C76F47EB5265F4ULL, 0x5BE923F9E8F53A9BULL,
+    0x1C4359104312C5AFULL, 0xAF6D15AE40B59AC0ULL,
+    0x192D8AF2BAF0E1E8ULL, 0xAA03C64CB957BE87ULL,
+    0xEDA9BCA512B041B3ULL, 0x5E87F01B11171EDCULL,
+    0x62FD4976457FBFDBULL, 0xD1D305C846D8E0B4ULL,
+    0x96797F21ED3F1F80ULL, 0x2557339FEE9840EFULL,
+    0xEE8C0DFB45EE5D8EULL, 0x5DA24145464902E1ULL,
+    0x1A083BACEDAEFDD5ULL, 0xA9267712EE09A2BAULL,
+    0x955CCE7FBA6103BDULL, 0x267282C1B9C65CD2ULL,
+    0x61D8F8281221A3E6ULL, 0xD2F6B4961186FC89ULL,
+    0x9F8169BA49A54B33ULL, 0x2CAF25044A02145CULL,
+    0x6B055FEDE1E5EB68ULL, 0xD82B1353E242B407ULL,
+    0xE451AA3EB62A1500ULL, 0x577FE680B58D4A6FULL,
+    0x10D59C691E6AB55BULL, 0xA3FBD0D71DCDEA34ULL,
+    0x6820EEB3B6BBF755ULL, 0xDB0EA20DB51CA83AULL,
+    0x9CA4D8E41EFB570EULL, 0x2F8A945A1D5C0861ULL,
+    0x13F02D374934A966ULL, 0xA0DE61894A93F609ULL,
+    0xE7741B60E174093DULL, 0x545A57DEE2D35652ULL,
+    0xE21AC88218962D7AULL, 0x5134843C1B317215ULL,
+    0x169EFED5B0D68D21ULL, 0xA5B0B26BB371D24EULL,
+    0x99CA0B06E7197349ULL, 0x2AE447B8E4BE2C26ULL,
+    0x6D4E3D514F59D312ULL, 0xDE6071EF4CFE8C7DULL,
+    0x15BB4F8BE788911CULL, 0xA6950335E42FCE73ULL,
+    0xE13F79DC4FC83147ULL, 0x521135624C6F6E28ULL,
+    0x6E6B8C0F1807CF2FULL, 0xDD45C0B11BA09040ULL,
+    0x9AEFBA58B0476F74ULL, 0x29C1F6E6B3E0301BULL,
+    0xC96C5795D7870F42ULL, 0x7A421B2BD420502DULL,
+    0x3DE861C27FC7AF19ULL, 0x8EC62D7C7C60F076ULL,
+    0xB2BC941128085171ULL, 0x0192D8AF2BAF0E1EULL,
+    0x4638A2468048F12AULL, 0xF516EEF883EFAE45ULL,
+    0x3ECDD09C2899B324ULL, 0x8DE39C222B3EEC4BULL,
+    0xCA49E6CB80D9137FULL, 0x7967AA75837E4C10ULL,
+    0x451D1318D716ED17ULL, 0xF6335FA6D4B1B278ULL,
+    0xB199254F7F564D4CULL, 0x02B769F17CF11223ULL,
+    0xB4F7F6AD86B4690BULL, 0x07D9BA1385133664ULL,
+    0x4073C0FA2EF4C950ULL, 0xF35D8C442D53963FULL,
+    0xCF273529793B3738ULL, 0x7C0979977A9C6857ULL,
+    0x3BA3037ED17B9763ULL, 0x888D4FC0D2DCC80CULL,
+    0x435671A479AAD56DULL, 0xF0783D1A7A0D8A02ULL,
+    0xB7D247F3D1EA7536ULL, 0x04FC0B4DD24D2A59ULL,
+    0x3886B22086258B5EULL, 0x8BA8FE9E8582D431ULL,
+    0xCC0284772E652B05ULL, 0x7F2CC8C92DC2746AULL,
+    0x325B15E575E1C3D0ULL, 0x8175595B76469CBFULL,
+    0xC6DF23B2DDA1638BULL, 0x75F16F0CDE063CE4ULL,
+    0x498BD6618A6E9DE3ULL, 0xFAA59ADF89C9C28CULL,
+    0xBD0FE036222E3DB8ULL, 0x0E21AC88218962D7ULL,
+    0xC5FA92EC8AFF7FB6ULL, 0x76D4DE52895820D9ULL,
+    0x317EA4BB22BFDFEDULL, 0x8250E80521188082ULL,
+    0xBE2A516875702185ULL, 0x0D041DD676D77EEAULL,
+    0x4AAE673FDD3081DEULL, 0xF9802B81DE97DEB1ULL,
+    0x4FC0B4DD24D2A599ULL, 0xFCEEF8632775FAF6ULL,
+    0xBB44828A8C9205C2ULL, 0x086ACE348F355AADULL,
+    0x34107759DB5DFBAAULL, 0x873E3BE7D8FAA4C5ULL,
+    0xC094410E731D5BF1ULL, 0x73BA0DB070BA049EULL,
+    0xB86133D4DBCC19FFULL, 0x0B4F7F6AD86B4690ULL,
+    0x4CE50583738CB9A4ULL, 0xFFCB493D702BE6CBULL,
+    0xC3B1F050244347CCULL, 0x709FBCEE27E418A3ULL,
+    0x3735C6078C03E797ULL, 0x841B8AB98FA4B8F8ULL,
+    0xADDA7C5F3C4488E3ULL, 0x1EF430E13FE3D78CULL,
+    0x595E4A08940428B8ULL, 0xEA7006B697A377D7ULL,
+    0xD60ABFDBC3CBD6D0ULL, 0x6524F365C06C89BFULL,
+    0x228E898C6B8B768BULL, 0x91A0C532682C29E4ULL,
+    0x5A7BFB56C35A3485ULL, 0xE955B7E8C0FD6BEAULL,
+    0xAEFFCD016B1A94DEULL, 0x1DD181BF68BDCBB1ULL,
+    0x21AB38D23CD56AB6ULL, 0x9285746C3F7235D9ULL,
+    0xD52F0E859495CAEDULL, 0x6601423B97329582ULL,
+    0xD041DD676D77EEAAULL, 0x636F91D96ED0B1C5ULL,
+    0x24C5EB30C5374EF1ULL, 0x97EBA78EC690119EULL,
+    0xAB911EE392F8B099ULL, 0x18BF525D915FEFF6ULL,
+    0x5F1528B43AB810C2ULL, 0xEC3B640A391F4FADULL,
+    0x27E05A6E926952CCULL, 0x94CE16D091CE0DA3ULL,
+    0xD3646C393A29F297ULL, 0x604A2087398EADF8ULL,
+    0x5C3099EA6DE60CFFULL, 0xEF1ED5546E415390ULL,
+    0xA8B4AFBDC5A6ACA4ULL, 0x1B9AE303C601F3CBULL,
+    0x56ED3E2F9E224471ULL, 0xE5C372919D851B1EULL,
+    0xA26908783662E42AULL, 0x114744C635C5BB45ULL,
+    0x2D3DFDAB61AD1A42ULL, 0x9E13B115620A452DULL,
+    0xD9B9CBFCC9EDBA19ULL, 0x6A978742CA4AE576ULL,
+    0xA14CB926613CF817ULL, 0x1262F598629BA778ULL,
+    0x55C88F71C97C584CULL, 0xE6E6C3CFCADB0723ULL,
+    0xDA9C7AA29EB3A624ULL, 0x69B2361C9D14F94BULL,
+    0x2E184CF536F3067FULL, 0x9D36004B35545910ULL,
+    0x2B769F17CF112238ULL, 0x9858D3A9CCB67D57ULL,
+    0xDFF2A94067518263ULL, 0x6CDCE5FE64F6DD0CULL,
+    0x50A65C93309E7C0BULL, 0xE388102D33392364ULL,
+    0xA4226AC498DEDC50ULL, 0x170C267A9B79833FULL,
+    0xDCD7181E300F9E5EULL, 0x6FF954A033A8C131ULL,
+    0x28532E49984F3E05ULL, 0x9B7D62F79BE8616AULL,
+    0xA707DB9ACF80C06DULL, 0x14299724CC279F02ULL,
+    0x5383EDCD67C06036ULL, 0xE0ADA17364673F59ULL
+};
+
+/* ========================================================================== */
+/*                          Function Definitions                              */
+/* ========================================================================== */
+
+uint64_t SafetyCheckers_sigUpdate(uint64_t sig, uint32_t data)
+{
+    uint64_t crc = sig;
+
+    /* Fold the register value into the signature, least significant byte first */
+    crc = gSafetyCheckers_SigTable[(uint32_t)(crc ^ data) & 0xFFU] ^ (crc >> 8U);
+    crc = gSafetyCheckers_SigTable[(uint32_t)(crc ^ (data >> 8U)) & 0xFFU] ^ (crc >> 8U);
+    crc = gSafetyCheckers_SigTable[(uint32_t)(crc ^ (data >> 16U)) & 0xFFU] ^ (crc >> 8U);
+    crc = gSafetyCheckers_SigTable[(uint32_t)(crc ^ (data >> 24U)) & 0xFFU] ^ (crc >> 8U);
+
+    return crc;
+}
+
+void SafetyCheckers_sigTreeInit(SafetyCheckers_SigTreeObj *obj, uint64_t *sigTree, uint32_t totalReg)
+{
+    uint32_t node;
+
+    obj->sigTree  = sigTree;
+    obj->totalReg = totalReg;
+    obj->regIdx   = 0U;
+    obj->leaf     = 0U;
+    obj->leafEnd  = SafetyCheckers_sigTreeLeafStart(1U, totalReg);
+
+    for (node = 0U; node < SAFETY_CHECKERS_SIG_TREE_SIZE; node++)
+    {
+        sigTree[node] = SAFETY_CHECKERS_SIG_SEED;
+    }
+}
+
+void SafetyCheckers_sigTreeAdd(SafetyCheckers_SigTreeObj *obj, uint32_t data)
+{
+    uint64_t *leafSig;
+
+    /* Move to the leaf holding this register, skipping leaves without registers */
+    while (obj->regIdx >= obj->leafEnd)
+    {
+        obj->leaf++;
+        obj->leafEnd = SafetyCheckers_sigTreeLeafStart(obj->leaf + 1U, obj->totalReg);
+    }
+
+    leafSig  = &obj->sigTree[(SAFETY_CHECKERS_SIG_TREE_LEAVES - 1U) + obj->leaf];
+    *leafSig = SafetyCheckers_sigUpdate(*leafSig, data);
+    obj->regIdx++;
+}
+
+void SafetyCheckers_sigTreeFinish(SafetyCheckers_SigTreeObj *obj)
+{
+    uint32_t node;
+    uint64_t sig;
+    const uint64_t *left;
+
+    for (node = SAFETY_CHECKERS_SIG_TREE_LEAVES - 1U; node > 0U; node--)
+    {
+        left = &obj->sigTree[(2U * node) - 1U];
+        sig  = SafetyCheckers_sigUpdate(SAFETY_CHECKERS_SIG_SEED, (uint32_t)left[0]);
+        sig  = SafetyCheckers_sigUpdate(sig, (uint32_t)(left[0] >> 32U));
+        sig  = SafetyCheckers_sigUpdate(sig, (uint32_t)left[1]);
+        sig  = SafetyCheckers_sigUpdate(sig, (uint32_t)(left[1] >> 32U));
+        obj->sigTree[node - 1U] = sig;
+    }
+}
+
+int32_t SafetyCheckers_sigTreeCompare(const uint64_t *goldenTree, const uint64_t *sigTree,
+                                      uint32_t totalReg, uint32_t *firstReg, uint32_t *regCount)
+{
+    uint32_t node = 0U;
+    uint32_t child;
+    uint32_t leafFirst = 0U;
+    uint32_t leafCount = SAFETY_CHECKERS_SIG_TREE_LEAVES;
+    uint32_t lastReg;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (goldenTree[0U] != sigTree[0U])
+    {
+        status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
+
+        /* Follow the mismatching child. Stop early if no child mismatches,
+         * in which case the whole range of the node is reported. */
+        while (leafCount > 1U)
+        {
+            child = (2U * node) + 1U;
+            leafCount = leafCount >> 1U;
+
+            if (goldenTree[child] != sigTree[child])
+            {
+                node = child;
+            }
+            else if (goldenTree[child + 1U] != sigTree[child + 1U])
+            {
+                node = child + 1U;
+                leafFirst += leafCount;
+            }
+            else
+            {
+                leafCount = leafCount << 1U;
+                break;
+            }
+        }
+
+        *firstReg = SafetyCheckers_sigTreeLeafStart(leafFirst, totalReg);
+        lastReg   = SafetyCheckers_sigTreeLeafStart(leafFirst + leafCount, totalReg);
+        *regCount = lastReg - *firstReg;
+    }
+
+    return status;
+}
+
+int32_t SafetyCheckers_snapshotCpuStart(void *arg, uint32_t srcAddr, uint32_t srcStride,
+                                        uint32_t count, uint32_t *dst)
+{
+    uint32_t index;
+
+    for (index = 0U; index < count; index++)
+    {
+        dst[index] = (uint32_t)CSL_REG32_RD(srcAddr + (srcStride * index));
+    }
+
+    return SAFETY_CHECKERS_SOK;
+}
+
+int32_t SafetyCheckers_snapshotCpuWait(void *arg)
+{
+    return SAFETY_CHECKERS_SOK;
+}
+
+int32_t SafetyCheckers_snapshotMemStart(void *arg, uint32_t srcAddr, uint32_t srcStride,
+                                        uint32_t count, uint32_t *dst)
+{
+    uint32_t index;
+    uint32_t winOffset;
+    const SafetyCheckers_SnapshotMemWindow *memWindow = (const SafetyCheckers_SnapshotMemWindow *)arg;
+    const uint8_t *winAddr;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((memWindow == NULL) || (dst == NULL) || (srcAddr < memWindow->baseAddr))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (count != 0U))
+    {
+        /* The last register of the run must be inside the window */
+        winOffset = srcAddr - memWindow->baseAddr;
+        if ((((uint64_t)srcStride * (count - 1U)) + winOffset + sizeof(uint32_t)) > memWindow->windowSize)
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (count != 0U))
+    {
+        winAddr = ((const uint8_t *)memWindow->window) + winOffset;
+        if (srcStride == sizeof(uint32_t))
+        {
+            (void)memcpy(dst, winAddr, count * sizeof(uint32_t));
+        }
+        else
+        {
+            for (index = 0U; index < count; index++)
+            {
+                (void)memcpy(&dst[index], &winAddr[srcStride * index], sizeof(uint32_t));
+            }
+        }
+    }
+
+    return status;
+}
+
+int32_t SafetyCheckers_snapshotMemWait(void *arg)
+{
+    return SAFETY_CHECKERS_SOK;
+}
+
+void SafetyCheckers_regSetGetDesc(const SafetyCheckers_RegSetTable *table, uint32_t index,
+                                  SafetyCheckers_RegSetDesc *desc)
+{
+    if (table->descArr != NULL)
+    {
+        *desc = table->descArr[table->firstDesc + index];
+    }
+    else
+    {
+        table->getDesc(table->firstDesc + index, desc);
+    }
+}
+
+uint32_t SafetyCheckers_regSetGetCount(const SafetyCheckers_RegSetTable *table)
+{
+    uint32_t index;
+    uint32_t totalReg = 0U;
+    SafetyCheckers_RegSetDesc desc;
+
+    for (index = 0U; index < table->numDesc; index++)
+    {
+        SafetyCheckers_regSetGetDesc(table, index, &desc);
+        totalReg += desc.numOffsets * desc.count;
+    }
+
+    return totalReg;
+}
+
+int32_t SafetyCheckers_regSetGetCfg(const SafetyCheckers_RegSetTable *table, void *regCfg,
+                                    uint32_t width, uint32_t size)
+{
+    uint32_t offset = 0U;
+    uint32_t index;
+    uint32_t regNum;
+    uint32_t instance;
+    uint32_t regAddr;
+    SafetyCheckers_RegSetDesc desc;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (regCfg == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (SafetyCheckers_regSetGetCount(table) > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        for (index = 0U; index < table->numDesc; index++)
+        {
+            SafetyCheckers_regSetGetDesc(table, index, &desc);
+            for (regNum = 0U; regNum < desc.numOffsets; regNum++)
+            {
+                regAddr = desc.baseAddr + desc.offsetArr[regNum];
+                for (instance = 0U; instance < desc.count; instance++)
+                {
+                    SafetyCheckers_regCfgWrite(regCfg, width, offset, (uint32_t)CSL_REG32_RD(regAddr));
+                    regAddr += desc.stride;
+                    offset++;
+                }
+            }
+        }
+    }
+
+    return status;
+}
+
+int32_t SafetyCheckers_regSetVerifyCfg(const SafetyCheckers_RegSetTable *table, const void *regCfg,
+                                       uint32_t width, uint32_t size)
+{
+    uint32_t offset = 0U;
+    uint32_t mismatchCnt = 0U;
+    uint32_t index;
+    uint32_t regNum;
+    uint32_t instance;
+    uint32_t regAddr;
+    uint32_t readData;
+    SafetyCheckers_RegSetDesc desc;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (regCfg == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (SafetyCheckers_regSetGetCount(table) > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        for (index = 0U; index < table->numDesc; index++)
+        {
+            SafetyCheckers_regSetGetDesc(table, index, &desc);
+            for (regNum = 0U; regNum < desc.numOffsets; regNum++)
+            {
+                regAddr = desc.baseAddr + desc.offsetArr[regNum];
+                for (instance = 0U; instance < desc.count; instance++)
+                {
+                    readData = (uint32_t)CSL_REG32_RD(regAddr);
+                    mismatchCnt |= SafetyCheckers_regCfgCompare(regCfg, width, offset, readData, desc.mask);
+                    regAddr += desc.stride;
+                    offset++;
+                }
+            }
+        }
+
+        if (mismatchCnt != 0U)
+        {
+            status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
+        }
+    }
+
+    return status;
+}
+
+uint64_t SafetyCheckers_regSetGetSig(const SafetyCheckers_RegSetTable *table)
+{
+    uint32_t index;
+    uint32_t regNum;
+    uint32_t instance;
+    uint32_t regAddr;
+    uint64_t sig = SAFETY_CHECKERS_SIG_SEED;
+    SafetyCheckers_RegSetDesc desc;
+
+    for (index = 0U; index < table->numDesc; index++)
+    {
+        SafetyCheckers_regSetGetDesc(table, index, &desc);
+        for (regNum = 0U; regNum < desc.numOffsets; regNum++)
+        {
+            regAddr = desc.baseAddr + desc.offsetArr[regNum];
+            for (instance = 0U; instance < desc.count; instance++)
+            {
+                sig = SafetyCheckers_sigUpdate(sig, (uint32_t)CSL_REG32_RD(regAddr) & desc.mask);
+                regAddr += desc.stride;
+            }
+        }
+    }
+
+    return sig;
+}
+
+void SafetyCheckers_regSetBuildSigTree(const SafetyCheckers_RegSetTable *table, uint64_t *sigTree,
+                                       uint32_t totalReg)
+{
+    uint32_t index;
+    uint32_t regNum;
+    uint32_t instance;
+    uint32_t regAddr;
+    SafetyCheckers_RegSetDesc desc;
+    SafetyCheckers_SigTreeObj sigTreeObj;
+
+    SafetyCheckers_sigTreeInit(&sigTreeObj, sigTree, totalReg);
+
+    for (index = 0U; index < table->numDesc; index++)
+    {
+        SafetyCheckers_regSetGetDesc(table, index, &desc);
+        for (regNum = 0U; regNum < desc.numOffsets; regNum++)
+        {
+            regAddr = desc.baseAddr + desc.offsetArr[regNum];
+            for (instance = 0U; instance < desc.count; instance++)
+            {
+                SafetyCheckers_sigTreeAdd(&sigTreeObj, (uint32_t)CSL_REG32_RD(regAddr) & desc.mask);
+                regAddr += desc.stride;
+            }
+        }
+    }
+
+    SafetyCheckers_sigTreeFinish(&sigTreeObj);
+}
+
+void SafetyCheckers_regSetGetLocation(const SafetyCheckers_RegSetTable *table, uint32_t regIdx,
+                                      SafetyCheckers_SigMismatch *mismatch)
+{
+    uint32_t index;
+    uint32_t setReg;
+    uint32_t regIndex = regIdx;
+    SafetyCheckers_RegSetDesc desc;
+
+    /* Find the register set holding the register, sets are stored one after the other */
+    for (index = 0U; index < table->numDesc; index++)
+    {
+        SafetyCheckers_regSetGetDesc(table, index, &desc);
+        setReg = desc.numOffsets * desc.count;
+        if (regIndex < setReg)
+        {
+            /* Within a set all the instances of a register are stored together */
+            mismatch->regIdx    = regIdx;
+            mismatch->module    = desc.module;
+            mismatch->instance  = regIndex % desc.count;
+            mismatch->regOffset = (desc.stride * mismatch->instance) + desc.offsetArr[regIndex / desc.count];
+            mismatch->regAddr   = desc.baseAddr + mismatch->regOffset;
+            break;
+        }
+        regIndex -= setReg;
+    }
+}
+
+int32_t SafetyCheckers_regSetLocateMismatch(const SafetyCheckers_RegSetTable *table, const void *regCfg,
+                                            uint32_t width, uint32_t size,
+                                            SafetyCheckers_SigMismatch *mismatch)
+{
+    uint32_t offset = 0U;
+    uint32_t lastReg;
+    uint32_t index;
+    uint32_t regNum;
+    uint32_t instance;
+    uint32_t regAddr;
+    uint32_t readData;
+    SafetyCheckers_RegSetDesc desc;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((regCfg == NULL) || (mismatch == NULL))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (SafetyCheckers_regSetGetCount(table) > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) &&
+        ((mismatch->regIdx >= size) || (mismatch->regCount > (size - mismatch->regIdx))))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        lastReg = mismatch->regIdx + mismatch->regCount;
+
+        /* Walk the table in read order, only the registers of the range are read */
+        for (index = 0U; (index < table->numDesc) && (offset < lastReg) &&
+                         (status == SAFETY_CHECKERS_SOK); index++)
+        {
+            SafetyCheckers_regSetGetDesc(table, index, &desc);
+            if ((offset + (desc.numOffsets * desc.count)) <= mismatch->regIdx)
+            {
+                offset += desc.numOffsets * desc.count;
+            }
+            else
+            {
+                for (regNum = 0U; (regNum < desc.numOffsets) && (offset < lastReg) &&
+                                  (status == SAFETY_CHECKERS_SOK); regNum++)
+                {
+                    regAddr = desc.baseAddr + desc.offsetArr[regNum];
+                    for (instance = 0U; (instance < desc.count) && (offset < lastReg); instance++)
+                    {
+                        if (offset >= mismatch->regIdx)
+                        {
+                            readData = (uint32_t)CSL_REG32_RD(regAddr);
+                            if (SafetyCheckers_regCfgCompare(regCfg, width, offset, readData, desc.mask) != 0U)
+                            {
+                                status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
+                                break;
+                            }
+                        }
+                        regAddr += desc.stride;
+                        offset++;
+                    }
+                }
+            }
+        }
+
+        if (status == SAFETY_CHECKERS_REG_DATA_MISMATCH)
+        {
+            SafetyCheckers_regSetGetLocation(table, offset, mismatch);
+            mismatch->regCount = 1U;
+        }
+    }
+
+    return status;
+}
+
+uint32_t SafetyCheckers_regSetNextRun(const SafetyCheckers_RegSetTable *table, SafetyCheckers_RegSetPos *pos,
+                                      uint32_t maxCount, SafetyCheckers_RegSetRun *run)
+{
+    uint32_t runValid = 0U;
+    SafetyCheckers_RegSetDesc desc;
+
+    while ((runValid == 0U) && (pos->desc < table->numDesc))
+    {
+        SafetyCheckers_regSetGetDesc(table, pos->desc, &desc);
+
+        if ((pos->offset < desc.numOffsets) && (pos->instance < desc.count))
+        {
+            run->count = desc.count - pos->instance;
+            if (run->count > maxCount)
+            {
+                run->count = maxCount;
+            }
+            run->regAddr  = desc.baseAddr + ((desc.stride * pos->instance) + desc.offsetArr[pos->offset]);
+            run->stride   = desc.stride;
+            run->mask     = desc.mask;
+            run->setCount = desc.count;
+            runValid      = 1U;
+
+            pos->instance += run->count;
+            if (pos->instance >= desc.count)
+            {
+                pos->instance = 0U;
+                pos->offset++;
+            }
+        }
+        else
+        {
+            /* Set done (or empty), move to the next one */
+            pos->offset   = 0U;
+            pos->instance = 0U;
+            pos->desc++;
+        }
+    }
+
+    return runValid;
+}
+
+int32_t SafetyCheckers_regSetVerifySnapshot(const SafetyCheckers_RegSetTable *table, const uintptr_t *regCfg,
+                                            uint32_t size, const SafetyCheckers_SnapshotOps *snapshotOps,
+                                            uint32_t *scratch, uint32_t scratchSize)
+{
+    uint32_t offset = 0U;
+    uint32_t mismatchCnt = 0U;
+    SafetyCheckers_RegSetPos pos = {0U, 0U, 0U};
+    SafetyCheckers_RegSetRun run;
+    int32_t  status;
+
+    status = SafetyCheckers_regSetCheckSnapshotArgs(table, regCfg, size, snapshotOps, scratch, scratchSize);
+
+    while ((status == SAFETY_CHECKERS_SOK) &&
+           (SafetyCheckers_regSetNextRun(table, &pos, scratchSize, &run) != 0U))
+    {
+        status = SafetyCheckers_regSetStartRun(snapshotOps, &run, scratch);
+        if (status == SAFETY_CHECKERS_SOK)
+        {
+            status = SafetyCheckers_regSetWaitRun(snapshotOps, &run);
+        }
+        if (status == SAFETY_CHECKERS_SOK)
+        {
+            mismatchCnt |= SafetyCheckers_regSetCompareRun(&regCfg[offset], scratch, &run);
+            offset += run.count;
+        }
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (mismatchCnt != 0U))
+    {
+        status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
+    }
+
+    return status;
+}
+
+int32_t SafetyCheckers_regSetVerifyPipelined(const SafetyCheckers_RegSetTable *table, const uintptr_t *regCfg,
+                                             uint32_t size, const SafetyCheckers_SnapshotOps *snapshotOps,
+                                             uint32_t *scratch, uint32_t scratchSize,
+                                             SafetyCheckers_GetTimeUsecFxn getTimeUsec,
+                                             SafetyCheckers_PipelineStats *stats)
+{
+    uint32_t offset = 0U;
+    uint32_t mismatchCnt = 0U;
+    uint32_t cur = 0U;
+    uint32_t next;
+    uint32_t runValid[2U] = {0U, 0U};
+    uint32_t *snapshot[2U];
+    uint64_t stageTime[4U] = {0U, 0U, 0U, 0U};
+    SafetyCheckers_PipelineStats pipeStats = {0U, 0U, 0U, 0U};
+    SafetyCheckers_RegSetPos pos = {0U, 0U, 0U};
+    SafetyCheckers_RegSetRun run[2U];
+    int32_t  status;
+
+    status = SafetyCheckers_regSetCheckSnapshotArgs(table, regCfg, size, snapshotOps, scratch, scratchSize);
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        /* scratch holds two snapshot buffers of scratchSize registers each */
+        snapshot[0U] = scratch;
+        snapshot[1U] = &scratch[scratchSize];
+
+        if (getTimeUsec != NULL)
+        {
+            stageTime[0U] = getTimeUsec();
+        }
+
+        runValid[cur] = SafetyCheckers_regSetNextRun(table, &pos, scratchSize, &run[cur]);
+        if (runValid[cur] != 0U)
+        {
+            status = SafetyCheckers_regSetStartRun(snapshotOps, &run[cur], snapshot[cur]);
+        }
+    }
+
+    while ((status == SAFETY_CHECKERS_SOK) && (runValid[cur] != 0U))
+    {
+        if (getTimeUsec != NULL)
+        {
+            stageTime[1U] = getTimeUsec();
+        }
+
+        status = SafetyCheckers_regSetWaitRun(snapshotOps, &run[cur]);
+
+        /* Fetch the next run into the other buffer while this one is compared */
+        next = cur ^ 1U;
+        runValid[next] = 0U;
+        if (status == SAFETY_CHECKERS_SOK)
+        {
+            runValid[next] = SafetyCheckers_regSetNextRun(table, &pos, scratchSize, &run[next]);
+            if (runValid[next] != 0U)
+            {
+                status = SafetyCheckers_regSetStartRun(snapshotOps, &run[next], snapshot[next]);
+            }
+        }
+
+        if (getTimeUsec != NULL)
+        {
+            stageTime[2U] = getTimeUsec();
+        }
+
+        if (status == SAFETY_CHECKERS_SOK)
+        {
+            mismatchCnt |= SafetyCheckers_regSetCompareRun(&regCfg[offset], snapshot[cur], &run[cur]);
+            offset += run[cur].count;
+            pipeStats.runCnt++;
+        }
+
+        if (getTimeUsec != NULL)
+        {
+            stageTime[3U] = getTimeUsec();
+            pipeStats.fetchUsec   += stageTime[2U] - stageTime[1U];
+            pipeStats.compareUsec += stageTime[3U] - stageTime[2U];
+        }
+
+        cur = next;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (mismatchCnt != 0U))
+    {
+        status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
+    }
+
+    if ((stats != NULL) && (status != SAFETY_CHECKERS_FAIL) && (status != SAFETY_CHECKERS_INSUFFICIENT_BUFF))
+    {
+        if (getTimeUsec != NULL)
+        {
+            pipeStats.totalUsec = getTimeUsec() - stageTime[0U];
+        }
+        *stats = pipeStats;
+    }
+
+    return status;
+}
+
+/* ========================================================================== */
+/*                       Static Function Definitions                          */
+/* ========================================================================== */
+
+static uint32_t SafetyCheckers_sigTreeLeafStart(uint32_t leaf, uint32_t totalReg)
+{
+    /* Register i belongs to leaf (i * LEAVES) / totalReg, so the first register
+     * of a leaf is ceil((leaf * totalReg) / LEAVES) */
+    return (uint32_t)((((uint64_t)leaf * totalReg) + (SAFETY_CHECKERS_SIG_TREE_LEAVES - 1U)) >> SAFETY_CHECKERS_SIG_TREE_DEPTH);
+}
+
+static int32_t SafetyCheckers_regSetCheckSnapshotArgs(const SafetyCheckers_RegSetTable *table,
+                                                      const uintptr_t *regCfg, uint32_t size,
+                                                      const SafetyCheckers_SnapshotOps *snapshotOps,
+                                                      const uint32_t *scratch, uint32_t scratchSize)
+{
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((regCfg == NULL) || (snapshotOps == NULL) || (scratch == NULL) ||
+        (snapshotOps->snapshotStart == NULL) || (snapshotOps->snapshotWait == NULL))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && ((SafetyCheckers_regSetGetCount(table) > size) || (scratchSize == 0U)))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+
+    return status;
+}
+
+static int32_t SafetyCheckers_regSetStartRun(const SafetyCheckers_SnapshotOps *snapshotOps,
+                                             const SafetyCheckers_RegSetRun *run, uint32_t *dst)
+{
+    int32_t  status;
+
+    /* Registers with few instances are not worth a backend transfer */
+    if (run->setCount < snapshotOps->minCount)
+    {
+        status = SafetyCheckers_snapshotCpuStart(NULL, run->regAddr, run->stride, run->count, dst);
+    }
+    else
+    {
+        status = snapshotOps->snapshotStart(snapshotOps->arg, run->regAddr, run->stride, run->count, dst);
+    }
+
+    return status;
+}
+
+static int32_t SafetyCheckers_regSetWaitRun(const SafetyCheckers_SnapshotOps *snapshotOps,
+                                            const SafetyCheckers_RegSetRun *run)
+{
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    /* CPU runs are complete once started */
+    if (run->setCount >= snapshotOps->minCount)
+    {
+        status = snapshotOps->snapshotWait(snapshotOps->arg);
+    }
+
+    return status;
+}
+
+static uint32_t SafetyCheckers_regSetCompareRun(const uintptr_t *regCfg, const uint32_t *snapshot,
+                                                const SafetyCheckers_RegSetRun *run)
+{
+    uint32_t  index;
+    uintptr_t diff = 0U;
+
+    for (index = 0U; index < run->count; index++)
+    {
+        diff |= regCfg[index] ^ (uintptr_t)snapshot[index];
+    }
+
+    /* The golden bits above the 32-bit register are compared too */
+    diff &= ~((uintptr_t)~run->mask);
+
+    return (diff != 0U) ? 1U : 0U;
+}
@@ -72,6 +72,26 @@ extern "C" {
 /** \brief Safety checkers status Insufficient Buffer */
 #define SAFETY_CHECKERS_INSUFFICIENT_BUFF                            (-3)
 
+/** \brief Safety checkers register signature seed value */
+#define SAFETY_CHECKERS_SIG_SEED                                     (0xFFFFFFFFFFFFFFFFULL)
+
+/**
+ * \brief  Depth of the register signature tree. The tree has
+ *         (1 << SAFETY_CHECKERS_SIG_TREE_DEPTH) leaves and each leaf covers an
+ *         equal share of the registers of a checker. It shall be defined to the
+ *         same value for the library and the application.
+ */
+#ifndef SAFETY_CHECKERS_SIG_TREE_DEPTH
+#define SAFETY_CHECKERS_SIG_TREE_DEPTH                               (6U)
+#endif
+/** \brief Number of leaves of the register signature tree */
+#define SAFETY_CHECKERS_SIG_TREE_LEAVES                              (1U << SAFETY_CHECKERS_SIG_TREE_DEPTH)
+/** \brief Number of 64-bit entries needed to store a register signature tree */
+#define SAFETY_CHECKERS_SIG_TREE_SIZE                                ((2U * SAFETY_CHECKERS_SIG_TREE_LEAVES) - 1U)
+
+/** \brief Register set mask comparing every bit of a register */
+#define SAFETY_CHECKERS_REGSET_MASK_ALL                              (0xFFFFFFFFU)
+
 /** \brief Safety checkers default ID */
 #define SAFETY_CHECKERS_PM_DEFAULT_ID                                (0x0U)
 /** \brief Safety checkers valid Device Request flag */
@@ -127,11 +147,227 @@ extern "C" {
 #define SAFETY_CHECKERS_DEFAULT_TIMEOUT                              (SCICLIENT_SERVICE_WAIT_FOREVER)
 #endif
 
+/**
+ * \brief  Packed 32-bit golden image layout.
+ *         The PSC, PLL and RM register dumps stored back to back in one uint32_t
+ *         array, as filled by the *RegCfg32 APIs. The sizes come from the SoC
+ *         header, so safety_checkers_soc.h shall be included to use them.
+ */
+#define SAFETY_CHECKERS_GOLDEN_PSC_OFFSET                            (0U)
+#define SAFETY_CHECKERS_GOLDEN_PLL_OFFSET                            (SAFETY_CHECKERS_GOLDEN_PSC_OFFSET + \
+                                                                      SAFETY_CHECKERS_PM_PSC_REGDUMP_SIZE)
+#define SAFETY_CHECKERS_GOLDEN_RM_OFFSET                             (SAFETY_CHECKERS_GOLDEN_PLL_OFFSET + \
+                                                                      SAFETY_CHECKERS_PM_PLL_REGDUMP_SIZE)
+/** \brief Number of uint32_t entries of the packed golden image */
+#define SAFETY_CHECKERS_GOLDEN_SIZE                                  (SAFETY_CHECKERS_GOLDEN_RM_OFFSET + \
+                                                                      SAFETY_CHECKERS_RM_REGDUMP_SIZE)
+
+/** \brief Function returning a free running time stamp in micro seconds */
+typedef uint64_t (*SafetyCheckers_GetTimeUsecFxn)(void);
+
+/**
+ * \brief  Function starting the copy of count 32-bit registers, srcStride bytes
+ *         apart starting at srcAddr, into dst. The copy may complete asynchronously.
+ */
+typedef int32_t (*SafetyCheckers_SnapshotStartFxn)(void *arg, uint32_t srcAddr, uint32_t srcStride,
+                                                   uint32_t count, uint32_t *dst);
+/** \brief Function waiting for the copy started by SafetyCheckers_SnapshotStartFxn */
+typedef int32_t (*SafetyCheckers_SnapshotWaitFxn)(void *arg);
+
 /* ========================================================================== */
 /*                         Structure Declarations                             */
 /* ========================================================================== */
 
-/* None */
+/**
+ *
+ * \brief   Structure to report the location of a register signature tree mismatch.
+ *          The mismatching range starts at the reported register and covers
+ *          regCount registers in the order they are read by the checker. The
+ *          signature tree only narrows a mismatch down to one leaf, i.e. to
+ *          about 1/SAFETY_CHECKERS_SIG_TREE_LEAVES of the registers, so regCount
+ *          is usually more than one. The range can be narrowed to the exact
+ *          register against a golden register configuration with
+ *          SafetyCheckers_regSetLocateMismatch.
+ *
+ */
+typedef struct
+{
+    /* Index in read order of the first mismatching register */
+    uint32_t regIdx;
+    /* Index of the module in the checker table holding the first mismatching register */
+    uint32_t module;
+    /* Instance (or PD/MD index for PSC) of the first mismatching register */
+    uint32_t instance;
+    /* Offset of the first mismatching register from the module base address */
+    uint32_t regOffset;
+    /* Address of the first mismatching register */
+    uint32_t regAddr;
+    /* Number of registers covered by the mismatching range */
+    uint32_t regCount;
+} SafetyCheckers_SigMismatch;
+
+/**
+ *
+ * \brief   Structure to describe a set of registers checked by the register set
+ *          engine. The set holds count instances of numOffsets registers, instance
+ *          i of register o being at baseAddr + offsetArr[o] + (stride * i). The
+ *          registers are read register by register, all the instances of one
+ *          register after the other, which is the order of the golden register
+ *          configurations of every checker.
+ *
+ */
+typedef struct
+{
+    /* Base address of the register set */
+    uint32_t baseAddr;
+    /* Distance between two instances of a register in bytes */
+    uint32_t stride;
+    /* Number of instances of each register */
+    uint32_t count;
+    /* Offsets of the registers from the base address */
+    const uint32_t *offsetArr;
+    /* Number of entries of offsetArr */
+    uint32_t numOffsets;
+    /* Register bits compared against the golden value */
+    uint32_t mask;
+    /* Index of the checker module (PSC, PLL, RM module, ...) holding the set */
+    uint32_t module;
+} SafetyCheckers_RegSetDesc;
+
+/** \brief Function filling the descriptor of register set index of a checker table */
+typedef void (*SafetyCheckers_RegSetDescFxn)(uint32_t index, SafetyCheckers_RegSetDesc *desc);
+
+/**
+ *
+ * \brief   Structure to hold a checker table of the register set engine.
+ *          The descriptors come from descArr, or from getDesc when descArr is
+ *          NULL so the SoC tables can be used in their own format. Only the
+ *          numDesc descriptors starting at firstDesc are part of the table.
+ *
+ */
+typedef struct
+{
+    /* Array of descriptors, can be NULL */
+    const SafetyCheckers_RegSetDesc *descArr;
+    /* Function filling a descriptor, used when descArr is NULL */
+    SafetyCheckers_RegSetDescFxn getDesc;
+    /* Index of the first descriptor of the table */
+    uint32_t firstDesc;
+    /* Number of descriptors of the table */
+    uint32_t numDesc;
+} SafetyCheckers_RegSetTable;
+
+/**
+ *
+ * \brief   Structure to hold the position of the next register of a register set
+ *          engine walk. A walk starts from a zero initialized position.
+ *
+ */
+typedef struct
+{
+    /* Descriptor of the next register, relative to firstDesc */
+    uint32_t desc;
+    /* Register of the next register */
+    uint32_t offset;
+    /* Instance of the next register */
+    uint32_t instance;
+} SafetyCheckers_RegSetPos;
+
+/**
+ *
+ * \brief   Structure to hold a strided run of instances of one register
+ *          returned by SafetyCheckers_regSetNextRun.
+ *
+ */
+typedef struct
+{
+    /* Address of the first register of the run */
+    uint32_t regAddr;
+    /* Distance between two registers of the run in bytes */
+    uint32_t stride;
+    /* Number of registers of the run */
+    uint32_t count;
+    /* Register bits compared against the golden value */
+    uint32_t mask;
+    /* Number of instances of the register the run was cut from */
+    uint32_t setCount;
+} SafetyCheckers_RegSetRun;
+
+/**
+ *
+ * \brief   Structure to hold the stage timing of a pipelined verify sweep.
+ *          fetchUsec is the time the CPU waited for a snapshot and started the
+ *          next one, i.e. the part of the fetch not hidden behind a compare.
+ *
+ */
+typedef struct
+{
+    /* Wall clock time of the sweep in micro seconds */
+    uint64_t totalUsec;
+    /* Time spent waiting for and starting snapshots in micro seconds */
+    uint64_t fetchUsec;
+    /* Time spent comparing snapshots in micro seconds */
+    uint64_t compareUsec;
+    /* Number of register runs fetched */
+    uint32_t runCnt;
+} SafetyCheckers_PipelineStats;
+
+/**
+ *
+ * \brief   Structure to hold a register snapshot backend.
+ *          A backend copies strided register runs into a RAM scratch buffer so the
+ *          checker only has to compare memory. Besides the CPU backend
+ *          (SafetyCheckers_snapshotCpuStart/Wait) and the memory window backend
+ *          (SafetyCheckers_snapshotMemStart/Wait), the application can plug in a
+ *          BCDMA/UDMA block copy channel here.
+ *
+ */
+typedef struct
+{
+    /* Function starting the copy of a register run */
+    SafetyCheckers_SnapshotStartFxn snapshotStart;
+    /* Function waiting for the copy of a register run */
+    SafetyCheckers_SnapshotWaitFxn snapshotWait;
+    /* Argument passed to snapshotStart and snapshotWait */
+    void *arg;
+    /* Runs shorter than minCount registers are read by the CPU directly */
+    uint32_t minCount;
+} SafetyCheckers_SnapshotOps;
+
+/**
+ *
+ * \brief   Structure to hold a simulated register window for the memory window
+ *          snapshot backend. Register address baseAddr maps to window[0].
+ *
+ */
+typedef struct
+{
+    /* Register address of the first word of the window */
+    uint32_t baseAddr;
+    /* Pointer to the memory holding the register values */
+    const uint32_t *window;
+    /* Size of the window in bytes */
+    uint32_t windowSize;
+} SafetyCheckers_SnapshotMemWindow;
+
+/**
+ *
+ * \brief   Structure to hold the state while a register signature tree is built
+ *
+ */
+typedef struct
+{
+    /* Pointer to the signature tree being built */
+    uint64_t *sigTree;
+    /* Total number of registers covered by the tree */
+    uint32_t totalReg;
+    /* Index of the next register to be added */
+    uint32_t regIdx;
+    /* Leaf the next register is added to */
+    uint32_t leaf;
+    /* Index of the first register of the next leaf */
+    uint32_t leafEnd;
+} SafetyCheckers_SigTreeObj;
 
 /* ========================================================================== */
 /*                  Internal/Private Function Declarations                    */
@@ -143,13 +379,350 @@ extern "C" {
 /*                          Function Declarations                             */
 /* ========================================================================== */
 
-/* None */
+/**
+ * \brief    API to fold one 32-bit register value into a register signature.
+ *           The signature is a CRC-64 (XZ polynomial) over the register values
+ *           in the order they are read. A signature is started from
+ *           SAFETY_CHECKERS_SIG_SEED.
+ *
+ * \param    sig               [IN]           Current signature value
+ * \param    data              [IN]           Register value to be added
+ *
+ * \return   Updated signature value
+ *
+ */
+uint64_t SafetyCheckers_sigUpdate(uint64_t sig, uint32_t data);
+
+/**
+ * \brief    API to start building a register signature tree.
+ *           The tree is stored in heap order: node 0 is the root and the
+ *           children of node n are 2n+1 and 2n+2. The leaves are stored last.
+ *
+ * \param    obj               [IN/OUT]       Signature tree build state
+ * \param    sigTree           [IN/OUT]       Pointer to SAFETY_CHECKERS_SIG_TREE_SIZE entries
+ * \param    totalReg          [IN]           Total number of registers to be added
+ *
+ */
+void SafetyCheckers_sigTreeInit(SafetyCheckers_SigTreeObj *obj, uint64_t *sigTree, uint32_t totalReg);
+
+/**
+ * \brief    API to add the next register value to a register signature tree
+ *
+ * \param    obj               [IN/OUT]       Signature tree build state
+ * \param    data              [IN]           Register value to be added
+ *
+ */
+void SafetyCheckers_sigTreeAdd(SafetyCheckers_SigTreeObj *obj, uint32_t data);
+
+/**
+ * \brief    API to compute the inner nodes of a register signature tree
+ *           once all the registers have been added.
+ *
+ * \param    obj               [IN/OUT]       Signature tree build state
+ *
+ */
+void SafetyCheckers_sigTreeFinish(SafetyCheckers_SigTreeObj *obj);
+
+/**
+ * \brief    API to compare two register signature trees.
+ *           Only the roots are compared when the trees match. Otherwise the
+ *           mismatching children are followed down to the smallest mismatching
+ *           range of registers.
+ *
+ * \param    goldenTree        [IN]           Golden signature tree
+ * \param    sigTree           [IN]           Current signature tree
+ * \param    totalReg          [IN]           Total number of registers covered by the trees
+ * \param    firstReg          [OUT]          Index of the first register of the mismatching range
+ * \param    regCount          [OUT]          Number of registers in the mismatching range
+ *
+ * \return   SAFETY_CHECKERS_SOK when the trees match, else SAFETY_CHECKERS_REG_DATA_MISMATCH
+ *
+ */
+int32_t SafetyCheckers_sigTreeCompare(const uint64_t *goldenTree, const uint64_t *sigTree,
+                                      uint32_t totalReg, uint32_t *firstReg, uint32_t *regCount);
+
+/**
+ * \brief    Snapshot backend start function reading the registers with the CPU.
+ *           The copy is complete when the function returns, arg is unused.
+ *
+ * \param    arg               [IN]           Unused
+ * \param    srcAddr           [IN]           Address of the first register
+ * \param    srcStride         [IN]           Distance between two registers in bytes
+ * \param    count             [IN]           Number of registers to copy
+ * \param    dst               [OUT]          Pointer to store the register values
+ *
+ * \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_snapshotCpuStart(void *arg, uint32_t srcAddr, uint32_t srcStride,
+                                        uint32_t count, uint32_t *dst);
+
+/**
+ * \brief    Snapshot backend wait function of the CPU backend
+ *
+ * \param    arg               [IN]           Unused
+ *
+ * \return   SAFETY_CHECKERS_SOK
+ *
+ */
+int32_t SafetyCheckers_snapshotCpuWait(void *arg);
+
+/**
+ * \brief    Snapshot backend start function copying the registers from a
+ *           simulated register window with memcpy. Used to test the snapshot
+ *           path on a host or with a saved register image.
+ *
+ * \param    arg               [IN]           Pointer to SafetyCheckers_SnapshotMemWindow
+ * \param    srcAddr           [IN]           Address of the first register
+ * \param    srcStride         [IN]           Distance between two registers in bytes
+ * \param    count             [IN]           Number of registers to copy
+ * \param    dst               [OUT]          Pointer to store the register values
+ *
+ * \return   SAFETY_CHECKERS_SOK in case of success, SAFETY_CHECKERS_FAIL when
+ *           the run is outside of the window.
+ *
+ */
+int32_t SafetyCheckers_snapshotMemStart(void *arg, uint32_t srcAddr, uint32_t srcStride,
+                                        uint32_t count, uint32_t *dst);
+
+/**
+ * \brief    Snapshot backend wait function of the memory window backend
+ *
+ * \param    arg               [IN]           Unused
+ *
+ * \return   SAFETY_CHECKERS_SOK
+ *
+ */
+int32_t SafetyCheckers_snapshotMemWait(void *arg);
+
+/**
+ * \brief    API to get a descriptor of a register set table
+ *
+ * \param    table             [IN]           Register set table
+ * \param    index             [IN]           Index of the descriptor, relative to firstDesc
+ * \param    desc              [OUT]          Descriptor of the register set
+ *
+ */
+void SafetyCheckers_regSetGetDesc(const SafetyCheckers_RegSetTable *table, uint32_t index,
+                                  SafetyCheckers_RegSetDesc *desc);
+
+/**
+ * \brief    API to get the number of registers of a register set table
+ *
+ * \param    table             [IN]           Register set table
+ *
+ * \return   Number of registers
+ *
+ */
+uint32_t SafetyCheckers_regSetGetCount(const SafetyCheckers_RegSetTable *table);
+
+/**
+ * \brief    API to read the registers of a register set table into a golden
+ *           register configuration whose entries are width bytes wide
+ *           (sizeof(uint32_t) or sizeof(uintptr_t)).
+ *
+ * \param    table             [IN]           Register set table
+ * \param    regCfg            [OUT]          Pointer to store the register values
+ * \param    width             [IN]           Width of a regCfg entry in bytes
+ * \param    size              [IN]           Number of entries of regCfg
+ *
+ * \return   SAFETY_CHECKERS_SOK in case of success else failure
+ *
+ */
+int32_t SafetyCheckers_regSetGetCfg(const SafetyCheckers_RegSetTable *table, void *regCfg,
+                                    uint32_t width, uint32_t size);
+
+/**
+ * \brief    API to compare the registers of a register set table against a
+ *           golden register configuration whose entries are width bytes wide.
+ *           Only the bits of the descriptor mask are compared.
+ *
+ * \param    table             [IN]           Register set table
+ * \param    regCfg            [IN]           Golden register configuration
+ * \param    width             [IN]           Width of a regCfg entry in bytes
+ * \param    size              [IN]           Number of entries of regCfg
+ *
+ * \return   SAFETY_CHECKERS_SOK in case of success, SAFETY_CHECKERS_REG_DATA_MISMATCH
+ *           on a register mismatch else failure
+ *
+ */
+int32_t SafetyCheckers_regSetVerifyCfg(const SafetyCheckers_RegSetTable *table, const void *regCfg,
+                                       uint32_t width, uint32_t size);
+
+/**
+ * \brief    API to compute the signature of the registers of a register set table
+ *
+ * \param    table             [IN]           Register set table
+ *
+ * \return   Register signature
+ *
+ */
+uint64_t SafetyCheckers_regSetGetSig(const SafetyCheckers_RegSetTable *table);
+
+/**
+ * \brief    API to build the signature tree of the registers of a register set table
+ *
+ * \param    table             [IN]           Register set table
+ * \param    sigTree           [OUT]          Pointer to SAFETY_CHECKERS_SIG_TREE_SIZE entries
+ * \param    totalReg          [IN]           Number of registers of the table
+ *
+ */
+void SafetyCheckers_regSetBuildSigTree(const SafetyCheckers_RegSetTable *table, uint64_t *sigTree,
+                                       uint32_t totalReg);
+
+/**
+ * \brief    API to get the location of a register from its index in read order.
+ *           mismatch->regCount is not updated.
+ *
+ * \param    table             [IN]           Register set table
+ * \param    regIdx            [IN]           Index of the register
+ * \param    mismatch          [OUT]          Location of the register
+ *
+ */
+void SafetyCheckers_regSetGetLocation(const SafetyCheckers_RegSetTable *table, uint32_t regIdx,
+                                      SafetyCheckers_SigMismatch *mismatch);
+
+/**
+ * \brief    API to narrow a signature tree mismatch down to the exact register.
+ *           Only the regCount registers of the mismatching range starting at
+ *           mismatch->regIdx are read back and compared against the golden
+ *           register configuration, whose entries are width bytes wide. The
+ *           first mismatching register is reported in mismatch with regCount 1.
+ *
+ * \param    table             [IN]           Register set table
+ * \param    regCfg            [IN]           Golden register configuration
+ * \param    width             [IN]           Width of a regCfg entry in bytes
+ * \param    size              [IN]           Number of entries of regCfg
+ * \param    mismatch          [IN/OUT]       Mismatching range, location of the register
+ *
+ * \return   SAFETY_CHECKERS_REG_DATA_MISMATCH when a register of the range
+ *           mismatches, SAFETY_CHECKERS_SOK when the whole range matches regCfg
+ *           else failure
+ *
+ */
+int32_t SafetyCheckers_regSetLocateMismatch(const SafetyCheckers_RegSetTable *table, const void *regCfg,
+                                            uint32_t width, uint32_t size,
+                                            SafetyCheckers_SigMismatch *mismatch);
+
+/**
+ * \brief    API to get the next strided run of instances of one register of a
+ *           register set table and advance the position past it.
+ *
+ * \param    table             [IN]           Register set table
+ * \param    pos               [IN/OUT]       Position of the walk
+ * \param    maxCount          [IN]           Maximum number of registers of the run
+ * \param    run               [OUT]          Register run
+ *
+ * \return   1 when a run is returned, 0 once every register has been walked
+ *
+ */
+uint32_t SafetyCheckers_regSetNextRun(const SafetyCheckers_RegSetTable *table, SafetyCheckers_RegSetPos *pos,
+                                      uint32_t maxCount, SafetyCheckers_RegSetRun *run);
+
+/**
+ * \brief    API to compare the registers of a register set table against a
+ *           golden register configuration through a snapshot backend. Every
+ *           register run is copied into scratch, in chunks of scratchSize
+ *           registers, and compared from there. Runs of registers with fewer
+ *           instances than the minCount of the backend are read by the CPU.
+ *
+ * \param    table             [IN]           Register set table
+ * \param    regCfg            [IN]           Golden register configuration
+ * \param    size              [IN]           Number of entries of regCfg
+ * \param    snapshotOps       [IN]           Snapshot backend
+ * \param    scratch           [IN/OUT]       Scratch memory for the register snapshot
+ * \param    scratchSize       [IN]           Number of registers fitting in scratch
+ *
+ * \return   SAFETY_CHECKERS_SOK in case of success else failure
+ *
+ */
+int32_t SafetyCheckers_regSetVerifySnapshot(const SafetyCheckers_RegSetTable *table, const uintptr_t *regCfg,
+                                            uint32_t size, const SafetyCheckers_SnapshotOps *snapshotOps,
+                                            uint32_t *scratch, uint32_t scratchSize);
+
+/**
+ * \brief    API to compare the registers of a register set table against a
+ *           golden register configuration through a snapshot backend with two
+ *           snapshot buffers. The copy of the next run is started into the second
+ *           buffer before the current one is compared.
+ *
+ * \param    table             [IN]           Register set table
+ * \param    regCfg            [IN]           Golden register configuration
+ * \param    size              [IN]           Number of entries of regCfg
+ * \param    snapshotOps       [IN]           Snapshot backend
+ * \param    scratch           [IN/OUT]       Scratch memory for 2 * scratchSize registers
+ * \param    scratchSize       [IN]           Number of registers fitting in one snapshot buffer
+ * \param    getTimeUsec       [IN]           Time stamp function for the stage timing, can be NULL
+ * \param    stats             [OUT]          Stage timing of the sweep, can be NULL
+ *
+ * \return   SAFETY_CHECKERS_SOK in case of success else failure
+ *
+ */
+int32_t SafetyCheckers_regSetVerifyPipelined(const SafetyCheckers_RegSetTable *table, const uintptr_t *regCfg,
+                                             uint32_t size, const SafetyCheckers_SnapshotOps *snapshotOps,
+                                             uint32_t *scratch, uint32_t scratchSize,
+                                             SafetyCheckers_GetTimeUsecFxn getTimeUsec,
+                                             SafetyCheckers_PipelineStats *stats);
 
 /* ========================================================================== */
 /*                       Static Function Definitions                          */
 /* ========================================================================== */
 
-/* None */
+/**
+ * \brief    Store one register value in a golden register configuration whose
+ *           entries are width bytes wide (sizeof(uint32_t) or sizeof(uintptr_t)).
+ */
+static inline void SafetyCheckers_regCfgWrite(void *regCfg, uint32_t width, uint32_t index, uint32_t value)
+{
+    if (width == sizeof(uint32_t))
+    {
+        ((uint32_t *)regCfg)[index] = value;
+    }
+    else
+    {
+        ((uintptr_t *)regCfg)[index] = (uintptr_t)value;
+    }
+}
+
+/**
+ * \brief    Load one entry of a golden register configuration whose entries
+ *           are width bytes wide (sizeof(uint32_t) or sizeof(uintptr_t)).
+ *           uintptr_t entries are returned at full width.
+ */
+static inline uintptr_t SafetyCheckers_regCfgRead(const void *regCfg, uint32_t width, uint32_t index)
+{
+    uintptr_t value;
+
+    if (width == sizeof(uint32_t))
+    {
+        value = (uintptr_t)((const uint32_t *)regCfg)[index];
+    }
+    else
+    {
+        value = ((const uintptr_t *)regCfg)[index];
+    }
+
+    return value;
+}
+
+/**
+ * \brief    Compare one register value against an entry of a golden register
+ *           configuration whose entries are width bytes wide. Only the bits of
+ *           mask are compared within the register, the bits of a uintptr_t
+ *           entry above the register must be zero.
+ *
+ * \return   0 when the register matches, else 1
+ */
+static inline uint32_t SafetyCheckers_regCfgCompare(const void *regCfg, uint32_t width, uint32_t index,
+                                                    uint32_t readData, uint32_t mask)
+{
+    uintptr_t diff;
+
+    diff = SafetyCheckers_regCfgRead(regCfg, width, index) ^ (uintptr_t)readData;
+    diff &= ~((uintptr_t)~mask);
+
+    return (diff != 0U) ? 1U : 0U;
+}
 
 #ifdef __cplusplus
 }
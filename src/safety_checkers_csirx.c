@@ -71,6 +71,18 @@ static int32_t SafetyCheckers_csirxGetVimRegCfgIntrNum(uint32_t intrNum,
 
 static int32_t SafetyCheckers_csirxVerifyVimRegCfgIntrNum(SafetyCheckers_CsirxVimCfg *vimCfg);
 
+static int32_t SafetyCheckers_csirxGetRegCfgWidth(void *regCfg,
+                                                  uint32_t width,
+                                                  uint32_t regType,
+                                                  uint32_t instance);
+
+static int32_t SafetyCheckers_csirxVerifyRegCfgWidth(const void *regCfg,
+                                                     uint32_t width,
+                                                     uint32_t regType,
+                                                     uint32_t instance);
+
+static void SafetyCheckers_csirxGetRegSetDesc(uint32_t index, SafetyCheckers_RegSetDesc *desc);
+
 /* ========================================================================== */
 /*                            Global Variables                                */
 /* ========================================================================== */
@@ -189,61 +201,28 @@ int32_t SafetyCheckers_csirxGetRegCfg(uintptr_t *regCfg,
                                       uint32_t regType,
                                       uint32_t instance)
 {
-    uint32_t regNum;
-    int32_t  status = SAFETY_CHECKERS_SOK;
-    uint32_t baseAddr;
-
-    /* Check if regCfg is NULL */
-    if(NULL == regCfg)
-    {
-        status = SAFETY_CHECKERS_FAIL;
-    }
-
-    if(SAFETY_CHECKERS_SOK == status)
-    {
-        baseAddr = gSafetyCheckers_CsirxRegData[regType].instData[instance].baseAddr;
-        for(regNum=0U; regNum<(gSafetyCheckers_CsirxRegData[regType].instData[instance].length); regNum++)
-        {
-            regCfg[regNum] = (uintptr_t)CSL_REG32_RD(baseAddr +
-                                                     gSafetyCheckers_CsirxRegData[regType].instData[instance].regOffsetArr[regNum]);
-        }
-    }
+    return SafetyCheckers_csirxGetRegCfgWidth(regCfg, (uint32_t)sizeof(uintptr_t), regType, instance);
+}
 
-    return status;
+int32_t SafetyCheckers_csirxGetRegCfg32(uint32_t *regCfg,
+                                        uint32_t regType,
+                                        uint32_t instance)
+{
+    return SafetyCheckers_csirxGetRegCfgWidth(regCfg, (uint32_t)sizeof(uint32_t), regType, instance);
 }
 
 int32_t SafetyCheckers_csirxVerifyRegCfg(const uintptr_t *regCfg,
                                          uint32_t regType,
                                          uint32_t instance)
 {
-    uint32_t readData = 0U;
-    uint32_t mismatchCnt = 0U;
-    uint32_t regNum;
-    int32_t  status = SAFETY_CHECKERS_SOK;
-    uint32_t baseAddr;
-
-    /* Check if regCfg is NULL */
-    if(NULL == regCfg)
-    {
-        status = SAFETY_CHECKERS_FAIL;
-    }
-
-    if(SAFETY_CHECKERS_SOK == status)
-    {
-        baseAddr = gSafetyCheckers_CsirxRegData[regType].instData[instance].baseAddr;
-        for(regNum=0U; regNum<(gSafetyCheckers_CsirxRegData[regType].instData[instance].length); regNum++)
-        {
-            readData = (uintptr_t)CSL_REG32_RD(baseAddr + gSafetyCheckers_CsirxRegData[regType].instData[instance].regOffsetArr[regNum]);
-            mismatchCnt |= regCfg[regNum] ^ readData;
-        }
-
-        if(0U != mismatchCnt)
-        {
-            status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
-        }
-    }
+    return SafetyCheckers_csirxVerifyRegCfgWidth(regCfg, (uint32_t)sizeof(uintptr_t), regType, instance);
+}
 
-    return status;
+int32_t SafetyCheckers_csirxVerifyRegCfg32(const uint32_t *regCfg,
+                                           uint32_t regType,
+                                           uint32_t instance)
+{
+    return SafetyCheckers_csirxVerifyRegCfgWidth(regCfg, (uint32_t)sizeof(uint32_t), regType, instance);
 }
 
 int32_t SafetyCheckers_csirxVerifyCsiAvailBandwidth(void *drvHandle, uint32_t fps)
@@ -484,6 +463,48 @@ int32_t SafetyCheckers_csirxVerifyQoSCfg(SafetyCheckers_CsirxQoSSettings *qosSet
 /*                       Static Function Definitions                          */
 /* ========================================================================== */
 
+static int32_t SafetyCheckers_csirxGetRegCfgWidth(void *regCfg,
+                                                  uint32_t width,
+                                                  uint32_t regType,
+                                                  uint32_t instance)
+{
+    /* One register set per register type and CSIRX instance */
+    SafetyCheckers_RegSetTable table = {NULL, SafetyCheckers_csirxGetRegSetDesc, 0U, 1U};
+
+    table.firstDesc = (regType * SAFETY_CHECKERS_CSIRX_INSTANCES_MAX) + instance;
+
+    return SafetyCheckers_regSetGetCfg(&table, regCfg, width,
+                                       gSafetyCheckers_CsirxRegData[regType].instData[instance].length);
+}
+
+static int32_t SafetyCheckers_csirxVerifyRegCfgWidth(const void *regCfg,
+                                                     uint32_t width,
+                                                     uint32_t regType,
+                                                     uint32_t instance)
+{
+    SafetyCheckers_RegSetTable table = {NULL, SafetyCheckers_csirxGetRegSetDesc, 0U, 1U};
+
+    table.firstDesc = (regType * SAFETY_CHECKERS_CSIRX_INSTANCES_MAX) + instance;
+
+    return SafetyCheckers_regSetVerifyCfg(&table, regCfg, width,
+                                          gSafetyCheckers_CsirxRegData[regType].instData[instance].length);
+}
+
+static void SafetyCheckers_csirxGetRegSetDesc(uint32_t index, SafetyCheckers_RegSetDesc *desc)
+{
+    const SafetyCheckers_CsirxInstData *instData;
+
+    instData = &gSafetyCheckers_CsirxRegData[index / SAFETY_CHECKERS_CSIRX_INSTANCES_MAX].instData[index % SAFETY_CHECKERS_CSIRX_INSTANCES_MAX];
+
+    desc->baseAddr   = instData->baseAddr;
+    desc->stride     = 0U;
+    desc->count      = 1U;
+    desc->offsetArr  = instData->regOffsetArr;
+    desc->numOffsets = instData->length;
+    desc->mask       = SAFETY_CHECKERS_REGSET_MASK_ALL;
+    desc->module     = index / SAFETY_CHECKERS_CSIRX_INSTANCES_MAX;
+}
+
 static int32_t SafetyCheckers_csirxGetVimRegCfgIntrNum(uint32_t intrNum,
                                                        SafetyCheckers_CsirxVimCfg *vimCfg)
 {
@@ -280,6 +280,22 @@ int32_t SafetyCheckers_csirxGetRegCfg(uintptr_t *regCfg,
                                       uint32_t regType,
                                       uint32_t instance);
 
+/**
+ *  \brief Function to get register configuration of requested type
+ *         in a 32-bit register configuration
+ *
+ *  \param regCfg   Pointer to 32-bit register configuration
+ *  \param regType  Type of register configuration
+ *  \param instance CSIRX instance ID
+ *
+ *  \return SAFETY_CHECKERS_SOK if successful
+ *          SAFETY_CHECKERS_FAIL if NULL params are passed
+ *
+ */
+int32_t SafetyCheckers_csirxGetRegCfg32(uint32_t *regCfg,
+                                        uint32_t regType,
+                                        uint32_t instance);
+
 /**
  *  \brief Function to verify register configuration of requested type
  *
@@ -296,6 +312,22 @@ int32_t SafetyCheckers_csirxVerifyRegCfg(const uintptr_t *regCfg,
                                          uint32_t regType,
                                          uint32_t instance);
 
+/**
+ *  \brief Function to verify a 32-bit register configuration of requested type
+ *
+ *  \param regCfg   Pointer to 32-bit register configuration
+ *  \param regType  Type of register configuration
+ *  \param instance CSIRX instance ID
+ *
+ *  \return SAFETY_CHECKERS_SOK if successful
+ *          SAFETY_CHECKERS_FAIL if NULL params are passed
+ *          SAFETY_CHECKERS_REG_DATA_MISMATCH  if verification is failed
+ *
+ */
+int32_t SafetyCheckers_csirxVerifyRegCfg32(const uint32_t *regCfg,
+                                           uint32_t regType,
+                                           uint32_t instance);
+
 /**
  *  \brief Function to verify if requested configuration is within CSIRX IP
  *  limits
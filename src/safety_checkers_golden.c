@@ -0,0 +1,824 @@
+/*
+ *  Copyright (C) 2024 Texas Instruments Incorporated
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/**
+ *  \file     safety_checkers_golden.c
+ *
+ *  \brief    This file contains golden image container library functions
+ *
+ */
+
+/* ========================================================================== */
+/*                             Include Files                                  */
+/* ========================================================================== */
+
+#include <stdint.h>
+#include <cslr.h>
+#include <sciclient.h>
+#include <safety_checkers_common.h>
+#include <safety_checkers_pm.h>
+#include <safety_checkers_rm.h>
+#include <safety_checkers_tifs.h>
+#include <safety_checkers_golden.h>
+
+/* ========================================================================== */
+/*                           Macros & Typedefs                                */
+/* ========================================================================== */
+
+/** \brief Number of header words covered by the header signature */
+#define SAFETY_CHECKERS_GOLDEN_HDR_SIG_WORDS            (SAFETY_CHECKERS_GOLDEN_HDR_WORDS - 2U)
+/** \brief Number of words in front of the firewall registers of a TIFS section */
+#define SAFETY_CHECKERS_GOLDEN_TIFS_SEC_HDR_WORDS       (2U)
+/** \brief Number of retained region header words covered by the retain signature */
+#define SAFETY_CHECKERS_GOLDEN_RETAIN_SIG_WORDS         (SAFETY_CHECKERS_GOLDEN_RETAIN_HDR_WORDS - 2U)
+
+/* ========================================================================== */
+/*                         Structure Declarations                             */
+/* ========================================================================== */
+
+/* None */
+
+/* ========================================================================== */
+/*                          Function Declarations                             */
+/* ========================================================================== */
+
+static int32_t SafetyCheckers_goldenNewSection(uint32_t *image, uint32_t type, uint32_t count,
+                                               uint32_t **data, SafetyCheckers_GoldenSection **section);
+static void SafetyCheckers_goldenSealSection(const uint32_t *image, SafetyCheckers_GoldenSection *section);
+static uint64_t SafetyCheckers_goldenDataSig(uint64_t sig, const uint32_t *data, uint32_t count);
+static uint64_t SafetyCheckers_goldenHdrSig(const uint32_t *image);
+static uint64_t SafetyCheckers_goldenTableSig(void);
+static const SafetyCheckers_GoldenSection *SafetyCheckers_goldenFindSection(const uint32_t *image,
+                                                                            uint32_t type, uint32_t index);
+static uint32_t SafetyCheckers_goldenIsWarmReset(void);
+
+/* ========================================================================== */
+/*                            Global Variables                                */
+/* ========================================================================== */
+
+/* None */
+
+/* ========================================================================== */
+/*                          Function Definitions                              */
+/* ========================================================================== */
+
+int32_t SafetyCheckers_goldenInit(uint32_t *image, uint32_t size, uint32_t coreId, uint32_t maxSections)
+{
+    uint32_t type;
+    SafetyCheckers_GoldenHdr *hdr;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((image == NULL) || ((((uintptr_t)image) & 0x7U) != 0U) || (maxSections == 0U))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) &&
+        ((size < SAFETY_CHECKERS_GOLDEN_HDR_WORDS) ||
+         (((size - SAFETY_CHECKERS_GOLDEN_HDR_WORDS) / SAFETY_CHECKERS_GOLDEN_SEC_WORDS) < maxSections)))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        hdr = (SafetyCheckers_GoldenHdr *)image;
+        hdr->magic         = SAFETY_CHECKERS_GOLDEN_MAGIC;
+        hdr->formatVersion = SAFETY_CHECKERS_GOLDEN_FORMAT_VERSION;
+        hdr->socId         = SAFETY_CHECKERS_GOLDEN_SOC_ID;
+        hdr->coreId        = coreId;
+        hdr->libVersion    = SAFETY_CHECKERS_LIB_VERSION;
+        hdr->imageSize     = (uint32_t)(SAFETY_CHECKERS_GOLDEN_HDR_WORDS + (maxSections * SAFETY_CHECKERS_GOLDEN_SEC_WORDS)) * 4U;
+        hdr->imageCapacity = size * 4U;
+        hdr->numSections   = 0U;
+        hdr->maxSections   = maxSections;
+        hdr->reserved      = 0U;
+        hdr->tableSig      = SafetyCheckers_goldenTableSig();
+        for (type = 0U; type < SAFETY_CHECKERS_GOLDEN_SEC_TYPE_MAX; type++)
+        {
+            hdr->typeFirst[type] = 0U;
+            hdr->typeCount[type] = 0U;
+        }
+        hdr->hdrSig        = 0U;
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_goldenAddPm(uint32_t *image)
+{
+    uint32_t index;
+    uint32_t count;
+    uint32_t *data = NULL;
+    SafetyCheckers_GoldenSection *section = NULL;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    for (index = 0U; (index < SafetyCheckers_pmGetNumPsc()) && (status == SAFETY_CHECKERS_SOK); index++)
+    {
+        count = SafetyCheckers_pmGetPscModuleRegCount(index);
+        status = SafetyCheckers_goldenNewSection(image, SAFETY_CHECKERS_GOLDEN_SEC_TYPE_PSC, count, &data, &section);
+        if (status == SAFETY_CHECKERS_SOK)
+        {
+            status = SafetyCheckers_pmGetPscModuleRegCfg32(index, data, count);
+        }
+        if (status == SAFETY_CHECKERS_SOK)
+        {
+            SafetyCheckers_goldenSealSection(image, section);
+        }
+    }
+
+    for (index = 0U; (index < SafetyCheckers_pmGetNumPll()) && (status == SAFETY_CHECKERS_SOK); index++)
+    {
+        count = SafetyCheckers_pmGetPllModuleRegCount(index);
+        status = SafetyCheckers_goldenNewSection(image, SAFETY_CHECKERS_GOLDEN_SEC_TYPE_PLL, count, &data, &section);
+        if (status == SAFETY_CHECKERS_SOK)
+        {
+            status = SafetyCheckers_pmGetPllModuleRegCfg32(index, data, count);
+        }
+        if (status == SAFETY_CHECKERS_SOK)
+        {
+            SafetyCheckers_goldenSealSection(image, section);
+        }
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_goldenAddRm(uint32_t *image)
+{
+    uint32_t module;
+    uint32_t count;
+    uint32_t *data = NULL;
+    SafetyCheckers_GoldenSection *section = NULL;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    for (module = 0U; (module < SafetyCheckers_rmGetNumModules()) && (status == SAFETY_CHECKERS_SOK); module++)
+    {
+        count = SafetyCheckers_rmGetModuleRegCount(module);
+        status = SafetyCheckers_goldenNewSection(image, SAFETY_CHECKERS_GOLDEN_SEC_TYPE_RM, count, &data, &section);
+        if (status == SAFETY_CHECKERS_SOK)
+        {
+            status = SafetyCheckers_rmGetModuleRegCfg32(module, data, count);
+        }
+        if (status == SAFETY_CHECKERS_SOK)
+        {
+            SafetyCheckers_goldenSealSection(image, section);
+        }
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_goldenAddTifs(uint32_t *image, const SafetyCheckers_TifsFwlConfig *fwlConfig, uint32_t size)
+{
+    uint32_t i;
+    uint32_t count;
+    uint32_t *data = NULL;
+    SafetyCheckers_GoldenSection *section = NULL;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (fwlConfig == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    for (i = 0U; (i < size) && (status == SAFETY_CHECKERS_SOK); i++)
+    {
+        if (fwlConfig[i].numRegions > SAFETY_CHECKERS_TIFS_MAX_REGIONS)
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+
+        if (status == SAFETY_CHECKERS_SOK)
+        {
+            count = SAFETY_CHECKERS_GOLDEN_TIFS_SEC_HDR_WORDS +
+                    (fwlConfig[i].numRegions * SAFETY_CHECKERS_TIFS_REGS_PER_REGION);
+            status = SafetyCheckers_goldenNewSection(image, SAFETY_CHECKERS_GOLDEN_SEC_TYPE_TIFS_FWL, count, &data, &section);
+        }
+
+        if (status == SAFETY_CHECKERS_SOK)
+        {
+            data[0U] = fwlConfig[i].fwlId;
+            data[1U] = fwlConfig[i].numRegions;
+            status = SafetyCheckers_tifsGetFwlRegCfg32(fwlConfig[i].fwlId, fwlConfig[i].numRegions,
+                                                       &data[SAFETY_CHECKERS_GOLDEN_TIFS_SEC_HDR_WORDS],
+                                                       count - SAFETY_CHECKERS_GOLDEN_TIFS_SEC_HDR_WORDS);
+        }
+
+        if (status == SAFETY_CHECKERS_SOK)
+        {
+            SafetyCheckers_goldenSealSection(image, section);
+        }
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_goldenAddSection(uint32_t *image, uint32_t type, const uint32_t *data, uint32_t count)
+{
+    uint32_t i;
+    uint32_t *secData = NULL;
+    SafetyCheckers_GoldenSection *section = NULL;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (data == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        status = SafetyCheckers_goldenNewSection(image, type, count, &secData, &section);
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        for (i = 0U; i < count; i++)
+        {
+            secData[i] = data[i];
+        }
+        SafetyCheckers_goldenSealSection(image, section);
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_goldenFinish(uint32_t *image)
+{
+    SafetyCheckers_GoldenHdr *hdr;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((image == NULL) || (((const SafetyCheckers_GoldenHdr *)image)->magic != SAFETY_CHECKERS_GOLDEN_MAGIC))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        hdr = (SafetyCheckers_GoldenHdr *)image;
+        hdr->hdrSig = SafetyCheckers_goldenHdrSig(image);
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_goldenValidate(const uint32_t *image, uint32_t size)
+{
+    uint32_t i;
+    uint32_t type;
+    uint32_t dirEnd;
+    const SafetyCheckers_GoldenHdr *hdr;
+    const SafetyCheckers_GoldenSection *dir;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((image == NULL) || ((((uintptr_t)image) & 0x7U) != 0U) || (size < SAFETY_CHECKERS_GOLDEN_HDR_WORDS))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        hdr = (const SafetyCheckers_GoldenHdr *)image;
+        if ((hdr->magic != SAFETY_CHECKERS_GOLDEN_MAGIC) ||
+            (hdr->formatVersion != SAFETY_CHECKERS_GOLDEN_FORMAT_VERSION) ||
+            (hdr->socId != SAFETY_CHECKERS_GOLDEN_SOC_ID) ||
+            (hdr->tableSig != SafetyCheckers_goldenTableSig()) ||
+            (hdr->numSections > hdr->maxSections) ||
+            ((hdr->imageSize / 4U) > size))
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        /* The directory has to fit in the image before any entry is read */
+        dirEnd = (uint32_t)(SAFETY_CHECKERS_GOLDEN_HDR_WORDS + (hdr->maxSections * SAFETY_CHECKERS_GOLDEN_SEC_WORDS));
+        if ((hdr->maxSections > (size / SAFETY_CHECKERS_GOLDEN_SEC_WORDS)) || (dirEnd > (hdr->imageSize / 4U)) ||
+            (hdr->hdrSig != SafetyCheckers_goldenHdrSig(image)))
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        dir = (const SafetyCheckers_GoldenSection *)&image[SAFETY_CHECKERS_GOLDEN_HDR_WORDS];
+        for (i = 0U; (i < hdr->numSections) && (status == SAFETY_CHECKERS_SOK); i++)
+        {
+            if (((dir[i].offset & 0x3U) != 0U) || ((dir[i].offset / 4U) < dirEnd) ||
+                ((dir[i].offset / 4U) > (hdr->imageSize / 4U)) ||
+                (dir[i].count > ((hdr->imageSize / 4U) - (dir[i].offset / 4U))))
+            {
+                status = SAFETY_CHECKERS_FAIL;
+            }
+            else if (dir[i].sig != SafetyCheckers_goldenDataSig(SAFETY_CHECKERS_SIG_SEED, &image[dir[i].offset / 4U], dir[i].count))
+            {
+                status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
+            }
+            else
+            {
+                /* Section is intact */
+            }
+        }
+    }
+
+    /* The sections of a type are contiguous in the directory, in index order */
+    for (type = 0U; (type < SAFETY_CHECKERS_GOLDEN_SEC_TYPE_MAX) && (status == SAFETY_CHECKERS_SOK); type++)
+    {
+        if ((hdr->typeCount[type] > hdr->numSections) ||
+            (hdr->typeFirst[type] > (hdr->numSections - hdr->typeCount[type])))
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+
+        for (i = 0U; (i < hdr->typeCount[type]) && (status == SAFETY_CHECKERS_SOK); i++)
+        {
+            if ((dir[hdr->typeFirst[type] + i].type != type) || (dir[hdr->typeFirst[type] + i].index != i))
+            {
+                status = SAFETY_CHECKERS_FAIL;
+            }
+        }
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_goldenGetSection(const uint32_t *image, uint32_t type, uint32_t index,
+                                        const uint32_t **data, uint32_t *count)
+{
+    const SafetyCheckers_GoldenSection *section = NULL;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((image == NULL) || (data == NULL) || (count == NULL))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        section = SafetyCheckers_goldenFindSection(image, type, index);
+        if (section == NULL)
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        *data  = &image[section->offset / 4U];
+        *count = section->count;
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_goldenVerifySection(const uint32_t *image, uint32_t type, uint32_t index)
+{
+    const uint32_t *data = NULL;
+    uint32_t count = 0U;
+    int32_t  status;
+
+    status = SafetyCheckers_goldenGetSection(image, type, index, &data, &count);
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        switch (type)
+        {
+            case SAFETY_CHECKERS_GOLDEN_SEC_TYPE_PSC:
+                status = SafetyCheckers_pmVerifyPscModuleRegCfg32(index, data, count);
+                break;
+            case SAFETY_CHECKERS_GOLDEN_SEC_TYPE_PLL:
+                status = SafetyCheckers_pmVerifyPllModuleRegCfg32(index, data, count);
+                break;
+            case SAFETY_CHECKERS_GOLDEN_SEC_TYPE_RM:
+                status = SafetyCheckers_rmVerifyModuleRegCfg32(index, data, count);
+                break;
+            case SAFETY_CHECKERS_GOLDEN_SEC_TYPE_TIFS_FWL:
+                if (count < SAFETY_CHECKERS_GOLDEN_TIFS_SEC_HDR_WORDS)
+                {
+                    status = SAFETY_CHECKERS_FAIL;
+                }
+                else
+                {
+                    status = SafetyCheckers_tifsVerifyFwlRegCfg32(data[0U], data[1U],
+                                                                  &data[SAFETY_CHECKERS_GOLDEN_TIFS_SEC_HDR_WORDS],
+                                                                  count - SAFETY_CHECKERS_GOLDEN_TIFS_SEC_HDR_WORDS);
+                }
+                break;
+            default:
+                /* CSIRX sections are verified by the application */
+                status = SAFETY_CHECKERS_FAIL;
+                break;
+        }
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_goldenVerify(const uint32_t *image, uint32_t typeMask)
+{
+    uint32_t type;
+    uint32_t index;
+    int32_t  secStatus;
+    const SafetyCheckers_GoldenHdr *hdr;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (image == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        hdr = (const SafetyCheckers_GoldenHdr *)image;
+        for (type = 0U; (type < SAFETY_CHECKERS_GOLDEN_SEC_TYPE_MAX) &&
+                        ((status == SAFETY_CHECKERS_SOK) || (status == SAFETY_CHECKERS_REG_DATA_MISMATCH)); type++)
+        {
+            if ((type == SAFETY_CHECKERS_GOLDEN_SEC_TYPE_CSIRX) ||
+                ((typeMask & SAFETY_CHECKERS_GOLDEN_SEC_TYPE_MASK(type)) == 0U))
+            {
+                continue;
+            }
+
+            /* A mismatch is recorded but the remaining sections are still verified,
+             * any other error stops the verify and is reported */
+            for (index = 0U; (index < hdr->typeCount[type]) &&
+                             ((status == SAFETY_CHECKERS_SOK) || (status == SAFETY_CHECKERS_REG_DATA_MISMATCH)); index++)
+            {
+                secStatus = SafetyCheckers_goldenVerifySection(image, type, index);
+                if (secStatus != SAFETY_CHECKERS_SOK)
+                {
+                    status = secStatus;
+                }
+            }
+        }
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_goldenRetainSeal(uint32_t *region, uint32_t size)
+{
+    SafetyCheckers_GoldenRetainHdr *retainHdr;
+    const SafetyCheckers_GoldenHdr *hdr;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((region == NULL) || ((((uintptr_t)region) & 0x7U) != 0U) ||
+        (size < (SAFETY_CHECKERS_GOLDEN_RETAIN_HDR_WORDS + SAFETY_CHECKERS_GOLDEN_HDR_WORDS)))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        hdr = (const SafetyCheckers_GoldenHdr *)&region[SAFETY_CHECKERS_GOLDEN_RETAIN_HDR_WORDS];
+        if ((hdr->magic != SAFETY_CHECKERS_GOLDEN_MAGIC) ||
+            ((hdr->imageSize / 4U) > (size - SAFETY_CHECKERS_GOLDEN_RETAIN_HDR_WORDS)))
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        retainHdr = (SafetyCheckers_GoldenRetainHdr *)region;
+        retainHdr->magic       = SAFETY_CHECKERS_GOLDEN_RETAIN_MAGIC;
+        retainHdr->bootCount   = 0U;
+        retainHdr->regionSize  = size;
+        retainHdr->reserved    = 0U;
+        retainHdr->imageHdrSig = hdr->hdrSig;
+        retainHdr->retainSig   = SafetyCheckers_goldenDataSig(SAFETY_CHECKERS_SIG_SEED, region,
+                                                              (uint32_t)SAFETY_CHECKERS_GOLDEN_RETAIN_SIG_WORDS);
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_goldenRetainRestore(uint32_t *region, uint32_t size, const uint32_t **image,
+                                           uint32_t *bootCount)
+{
+    SafetyCheckers_GoldenRetainHdr *retainHdr;
+    const SafetyCheckers_GoldenHdr *hdr;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((region == NULL) || ((((uintptr_t)region) & 0x7U) != 0U) || (image == NULL) ||
+        (size < (SAFETY_CHECKERS_GOLDEN_RETAIN_HDR_WORDS + SAFETY_CHECKERS_GOLDEN_HDR_WORDS)))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    /* Retained contents are only trusted after an MCU warm reset */
+    if ((status == SAFETY_CHECKERS_SOK) && (SafetyCheckers_goldenIsWarmReset() == 0U))
+    {
+        status = SafetyCheckers_goldenRetainInvalidate(region);
+        if (status == SAFETY_CHECKERS_SOK)
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        retainHdr = (SafetyCheckers_GoldenRetainHdr *)region;
+        hdr = (const SafetyCheckers_GoldenHdr *)&region[SAFETY_CHECKERS_GOLDEN_RETAIN_HDR_WORDS];
+        if (retainHdr->magic != SAFETY_CHECKERS_GOLDEN_RETAIN_MAGIC)
+        {
+            /* Never sealed or invalidated, the application captures a new golden image */
+            status = SAFETY_CHECKERS_FAIL;
+        }
+        else if ((retainHdr->regionSize != size) ||
+                 (retainHdr->retainSig != SafetyCheckers_goldenDataSig(SAFETY_CHECKERS_SIG_SEED, region,
+                                                                       (uint32_t)SAFETY_CHECKERS_GOLDEN_RETAIN_SIG_WORDS)) ||
+                 (retainHdr->imageHdrSig != hdr->hdrSig) ||
+                 (SafetyCheckers_goldenValidate(&region[SAFETY_CHECKERS_GOLDEN_RETAIN_HDR_WORDS],
+                                                size - SAFETY_CHECKERS_GOLDEN_RETAIN_HDR_WORDS) != SAFETY_CHECKERS_SOK))
+        {
+            /* The image sealed before the warm reset is corrupted, a fault to report */
+            (void)SafetyCheckers_goldenRetainInvalidate(region);
+            status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
+        }
+        else
+        {
+            /* Sealed image validates */
+        }
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        retainHdr->bootCount++;
+        retainHdr->retainSig = SafetyCheckers_goldenDataSig(SAFETY_CHECKERS_SIG_SEED, region,
+                                                            (uint32_t)SAFETY_CHECKERS_GOLDEN_RETAIN_SIG_WORDS);
+        *image = &region[SAFETY_CHECKERS_GOLDEN_RETAIN_HDR_WORDS];
+        if (bootCount != NULL)
+        {
+            *bootCount = retainHdr->bootCount;
+        }
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_goldenRetainInvalidate(uint32_t *region)
+{
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (region == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+    else
+    {
+        ((SafetyCheckers_GoldenRetainHdr *)region)->magic = 0U;
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_goldenModeInit(SafetyCheckers_GoldenModeSet *modeSet)
+{
+    uint32_t mode;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (modeSet == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+    else
+    {
+        for (mode = 0U; mode < SAFETY_CHECKERS_GOLDEN_MODE_MAX; mode++)
+        {
+            modeSet->image[mode] = NULL;
+        }
+        modeSet->activeImage = NULL;
+        modeSet->activeMode  = SAFETY_CHECKERS_GOLDEN_MODE_MAX;
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_goldenModeAdd(SafetyCheckers_GoldenModeSet *modeSet, uint32_t mode,
+                                     const uint32_t *image, uint32_t size)
+{
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((modeSet == NULL) || (mode >= SAFETY_CHECKERS_GOLDEN_MODE_MAX))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        status = SafetyCheckers_goldenValidate(image, size);
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        modeSet->image[mode] = image;
+        if (modeSet->activeMode == mode)
+        {
+            modeSet->activeImage = image;
+        }
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_goldenModeSelect(SafetyCheckers_GoldenModeSet *modeSet, uint32_t mode)
+{
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((modeSet == NULL) || (mode >= SAFETY_CHECKERS_GOLDEN_MODE_MAX))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+    else if (modeSet->image[mode] == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+    else
+    {
+        modeSet->activeImage = modeSet->image[mode];
+        modeSet->activeMode  = mode;
+    }
+
+    return (status);
+}
+
+const uint32_t *SafetyCheckers_goldenModeGetImage(const SafetyCheckers_GoldenModeSet *modeSet)
+{
+    const uint32_t *image = NULL;
+
+    if (modeSet != NULL)
+    {
+        image = modeSet->activeImage;
+    }
+
+    return image;
+}
+
+int32_t SafetyCheckers_goldenModeVerify(const SafetyCheckers_GoldenModeSet *modeSet, uint32_t typeMask)
+{
+    return SafetyCheckers_goldenVerify(SafetyCheckers_goldenModeGetImage(modeSet), typeMask);
+}
+
+/* ========================================================================== */
+/*                       Static Function Definitions                          */
+/* ========================================================================== */
+
+static int32_t SafetyCheckers_goldenNewSection(uint32_t *image, uint32_t type, uint32_t count,
+                                               uint32_t **data, SafetyCheckers_GoldenSection **section)
+{
+    SafetyCheckers_GoldenHdr *hdr;
+    SafetyCheckers_GoldenSection *dir;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((image == NULL) || (type >= SAFETY_CHECKERS_GOLDEN_SEC_TYPE_MAX) ||
+        (((const SafetyCheckers_GoldenHdr *)image)->magic != SAFETY_CHECKERS_GOLDEN_MAGIC))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        hdr = (SafetyCheckers_GoldenHdr *)image;
+
+        /* Sections of one type are contiguous so that index lookup is a single add */
+        if ((hdr->typeCount[type] != 0U) &&
+            ((hdr->typeFirst[type] + hdr->typeCount[type]) != hdr->numSections))
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+        else if ((hdr->numSections >= hdr->maxSections) ||
+                 (count > ((hdr->imageCapacity - hdr->imageSize) / 4U)))
+        {
+            status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+        }
+        else
+        {
+            if (hdr->typeCount[type] == 0U)
+            {
+                hdr->typeFirst[type] = hdr->numSections;
+            }
+
+            dir = (SafetyCheckers_GoldenSection *)&image[SAFETY_CHECKERS_GOLDEN_HDR_WORDS];
+            dir[hdr->numSections].type   = type;
+            dir[hdr->numSections].index  = hdr->typeCount[type];
+            dir[hdr->numSections].offset = hdr->imageSize;
+            dir[hdr->numSections].count  = count;
+            dir[hdr->numSections].sig    = 0U;
+
+            *data    = &image[hdr->imageSize / 4U];
+            *section = &dir[hdr->numSections];
+
+            hdr->imageSize += count * 4U;
+            hdr->typeCount[type]++;
+            hdr->numSections++;
+        }
+    }
+
+    return (status);
+}
+
+static void SafetyCheckers_goldenSealSection(const uint32_t *image, SafetyCheckers_GoldenSection *section)
+{
+    section->sig = SafetyCheckers_goldenDataSig(SAFETY_CHECKERS_SIG_SEED, &image[section->offset / 4U], section->count);
+}
+
+static uint64_t SafetyCheckers_goldenDataSig(uint64_t sig, const uint32_t *data, uint32_t count)
+{
+    uint32_t i;
+
+    for (i = 0U; i < count; i++)
+    {
+        sig = SafetyCheckers_sigUpdate(sig, data[i]);
+    }
+
+    return sig;
+}
+
+static uint64_t SafetyCheckers_goldenHdrSig(const uint32_t *image)
+{
+    uint64_t sig;
+    const SafetyCheckers_GoldenHdr *hdr = (const SafetyCheckers_GoldenHdr *)image;
+
+    /* Header up to hdrSig followed by the directory entries in use */
+    sig = SafetyCheckers_goldenDataSig(SAFETY_CHECKERS_SIG_SEED, image, (uint32_t)SAFETY_CHECKERS_GOLDEN_HDR_SIG_WORDS);
+    sig = SafetyCheckers_goldenDataSig(sig, &image[SAFETY_CHECKERS_GOLDEN_HDR_WORDS],
+                                       (uint32_t)(hdr->numSections * SAFETY_CHECKERS_GOLDEN_SEC_WORDS));
+
+    return sig;
+}
+
+static uint64_t SafetyCheckers_goldenTableSig(void)
+{
+    uint64_t sig;
+    uint64_t rmSig;
+
+    sig   = SafetyCheckers_pmGetTableSig();
+    rmSig = SafetyCheckers_rmGetTableSig();
+    sig   = SafetyCheckers_sigUpdate(sig, (uint32_t)(rmSig & 0xFFFFFFFFU));
+    sig   = SafetyCheckers_sigUpdate(sig, (uint32_t)(rmSig >> 32U));
+
+    return sig;
+}
+
+static const SafetyCheckers_GoldenSection *SafetyCheckers_goldenFindSection(const uint32_t *image,
+                                                                            uint32_t type, uint32_t index)
+{
+    const SafetyCheckers_GoldenHdr *hdr = (const SafetyCheckers_GoldenHdr *)image;
+    const SafetyCheckers_GoldenSection *dir = (const SafetyCheckers_GoldenSection *)&image[SAFETY_CHECKERS_GOLDEN_HDR_WORDS];
+    const SafetyCheckers_GoldenSection *section = NULL;
+
+    if ((type < SAFETY_CHECKERS_GOLDEN_SEC_TYPE_MAX) && (index < hdr->typeCount[type]))
+    {
+        section = &dir[hdr->typeFirst[type] + index];
+    }
+
+    return section;
+}
+
+static uint32_t SafetyCheckers_goldenIsWarmReset(void)
+{
+    uint32_t resetSrc;
+    uint32_t warmReset = 0U;
+
+    resetSrc = CSL_REG32_RD(CSL_WKUP_CTRL_MMR0_CFG0_BASE + SAFETY_CHECKERS_PM_WKUP_CTRL_MMR_CFG0_RESET_SRC_STAT);
+    if ((resetSrc & SAFETY_CHECKERS_PM_WARM_RESET_MASK) == SAFETY_CHECKERS_PM_WARM_RESET_MASK)
+    {
+        warmReset = 1U;
+    }
+
+    return warmReset;
+}
@@ -0,0 +1,507 @@
+/*
+ *  Copyright (C) 2024 Texas Instruments Incorporated
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+ /**
+ *  \ingroup  SAFETY_CHECKERS
+ *  \defgroup GOLDEN_SAFETY_CHECKERS Golden Image Container
+ *
+ *  @{
+ *
+ *   The golden image container stores the PM, RM, TIFS firewall and CSIRX golden
+ *   register configurations of one core in a single versioned binary image. The
+ *   image header identifies the SoC, the core, the library version and the
+ *   register tables the golden sample was taken with. A directory of sections,
+ *   one per PSC, PLL, RM module, firewall and CSIRX register type, gives each
+ *   section its own offset, size and CRC, so any module can be located in O(1)
+ *   and verified straight from the image without copying it to RAM.
+ *
+ *   The validate, get section and verify APIs only read the image. An image
+ *   produced at integration time can be linked into read only, memory mapped
+ *   (OSPI XIP) flash with utils/safety_checkers_golden_to_c.py and verified in
+ *   place, without any get call at runtime.
+ */
+
+/**
+ *  \file    safety_checkers_golden.h
+ *
+ *  \brief   This file contains golden image container interfaces and related data structures.
+ *
+ */
+/** @} */
+
+#ifndef SAFETY_CHECKERS_GOLDEN_H_
+#define SAFETY_CHECKERS_GOLDEN_H_
+
+/* ========================================================================== */
+/*                             Include Files                                  */
+/* ========================================================================== */
+
+#include <safety_checkers_common.h>
+#include <safety_checkers_tifs.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup GOLDEN_SAFETY_CHECKERS
+ *
+ * @defgroup SAFETY_CHECKERS_GOLDEN_MACROS  SAFETY_CHECKERS_GOLDEN macro definition
+ *  @{
+ */
+
+/* ========================================================================== */
+/*                           Macros & Typedefs                                */
+/* ========================================================================== */
+
+/** \brief Golden image magic number ("SCGI" in little endian byte order) */
+#define SAFETY_CHECKERS_GOLDEN_MAGIC                                 (0x49474353U)
+/** \brief Golden image format version */
+#define SAFETY_CHECKERS_GOLDEN_FORMAT_VERSION                        (1U)
+/** \brief Safety checkers library version stored in the golden image (major.minor as 16.16) */
+#define SAFETY_CHECKERS_LIB_VERSION                                  (0x00010000U)
+
+#if defined (SOC_AM62X)
+/** \brief SoC identifier stored in the golden image */
+#define SAFETY_CHECKERS_GOLDEN_SOC_ID                                (1U)
+#elif defined (SOC_AM62AX)
+#define SAFETY_CHECKERS_GOLDEN_SOC_ID                                (2U)
+#elif defined (SOC_AM62PX)
+#define SAFETY_CHECKERS_GOLDEN_SOC_ID                                (3U)
+#elif defined (SOC_J722S)
+#define SAFETY_CHECKERS_GOLDEN_SOC_ID                                (4U)
+#elif defined (SOC_J7200)
+#define SAFETY_CHECKERS_GOLDEN_SOC_ID                                (5U)
+#elif defined (SOC_J721E)
+#define SAFETY_CHECKERS_GOLDEN_SOC_ID                                (6U)
+#elif defined (SOC_J721S2)
+#define SAFETY_CHECKERS_GOLDEN_SOC_ID                                (7U)
+#elif defined (SOC_J784S4)
+#define SAFETY_CHECKERS_GOLDEN_SOC_ID                                (8U)
+#endif
+
+/** \brief Section of the PDSTAT and MDSTAT registers of one PSC domain */
+#define SAFETY_CHECKERS_GOLDEN_SEC_TYPE_PSC                          (0U)
+/** \brief Section of the registers of one PLL */
+#define SAFETY_CHECKERS_GOLDEN_SEC_TYPE_PLL                          (1U)
+/** \brief Section of the registers of one RM module */
+#define SAFETY_CHECKERS_GOLDEN_SEC_TYPE_RM                           (2U)
+/** \brief Section of one TIFS firewall: fwlId, numRegions and eight registers per region */
+#define SAFETY_CHECKERS_GOLDEN_SEC_TYPE_TIFS_FWL                     (3U)
+/** \brief Section of one CSIRX register type */
+#define SAFETY_CHECKERS_GOLDEN_SEC_TYPE_CSIRX                        (4U)
+/** \brief Number of section types */
+#define SAFETY_CHECKERS_GOLDEN_SEC_TYPE_MAX                          (5U)
+/** \brief Bit of a section type in the type mask of SafetyCheckers_goldenVerify */
+#define SAFETY_CHECKERS_GOLDEN_SEC_TYPE_MASK(type)                   (1U << (type))
+
+/** \brief Retained golden image magic number ("SCGR" in little endian byte order) */
+#define SAFETY_CHECKERS_GOLDEN_RETAIN_MAGIC                          (0x52474353U)
+
+/** \brief Number of operating modes of a golden mode set */
+#define SAFETY_CHECKERS_GOLDEN_MODE_MAX                              (8U)
+/**
+ * \brief  Size of the retained region header in 32-bit words. The golden image
+ *         of a retained region starts right after it.
+ */
+#define SAFETY_CHECKERS_GOLDEN_RETAIN_HDR_WORDS                      (sizeof(SafetyCheckers_GoldenRetainHdr) / sizeof(uint32_t))
+
+/** \brief Size of the golden image header in 32-bit words */
+#define SAFETY_CHECKERS_GOLDEN_HDR_WORDS                             (sizeof(SafetyCheckers_GoldenHdr) / sizeof(uint32_t))
+/** \brief Size of a golden image directory entry in 32-bit words */
+#define SAFETY_CHECKERS_GOLDEN_SEC_WORDS                             (sizeof(SafetyCheckers_GoldenSection) / sizeof(uint32_t))
+
+/** @} */
+
+/* ========================================================================== */
+/*                            Global Variables                                */
+/* ========================================================================== */
+
+/* None */
+
+/**
+ * @ingroup GOLDEN_SAFETY_CHECKERS
+ *
+ * @defgroup SAFETY_CHECKERS_GOLDEN_STRUCTURE  SAFETY_CHECKERS_GOLDEN structure definition
+ *  @{
+ */
+
+/* ========================================================================== */
+/*                         Structure Declarations                             */
+/* ========================================================================== */
+
+/**
+ *
+ * \brief   Golden image header. It is stored at the start of the image and is
+ *          followed by maxSections directory entries and the section data.
+ *          All fields are naturally aligned so the layout is the same for the
+ *          target and for host tools.
+ *
+ */
+typedef struct
+{
+    uint32_t magic; /* SAFETY_CHECKERS_GOLDEN_MAGIC */
+    uint32_t formatVersion; /* SAFETY_CHECKERS_GOLDEN_FORMAT_VERSION */
+    uint32_t socId; /* SAFETY_CHECKERS_GOLDEN_SOC_ID of the SoC the image was taken on */
+    uint32_t coreId; /* Application defined id of the core the image belongs to */
+    uint32_t libVersion; /* SAFETY_CHECKERS_LIB_VERSION of the library that created the image */
+    uint32_t imageSize; /* Bytes used by the header, directory and section data */
+    uint32_t imageCapacity; /* Bytes available for the image */
+    uint32_t numSections; /* Number of directory entries in use */
+    uint32_t maxSections; /* Number of directory entries reserved after the header */
+    uint32_t reserved; /* Reserved, zero */
+    uint64_t tableSig; /* Signature of the PM and RM register tables */
+    uint32_t typeFirst[SAFETY_CHECKERS_GOLDEN_SEC_TYPE_MAX]; /* Directory index of the first section of each type */
+    uint32_t typeCount[SAFETY_CHECKERS_GOLDEN_SEC_TYPE_MAX]; /* Number of sections of each type */
+    uint64_t hdrSig; /* Signature of the header fields above and the directory entries in use */
+} SafetyCheckers_GoldenHdr;
+
+/**
+ *
+ * \brief   Golden image directory entry describing one section
+ *
+ */
+typedef struct
+{
+    uint32_t type; /* Section type, SAFETY_CHECKERS_GOLDEN_SEC_TYPE_* */
+    uint32_t index; /* PSC, PLL, RM module, firewall or CSIRX register type index */
+    uint32_t offset; /* Byte offset of the section data from the start of the image */
+    uint32_t count; /* Number of 32-bit words of section data */
+    uint64_t sig; /* Signature of the section data */
+} SafetyCheckers_GoldenSection;
+
+/**
+ *
+ * \brief   Header of a golden image kept in a memory region that is retained
+ *          across MCU warm reset. The golden image follows the header.
+ *
+ */
+typedef struct
+{
+    uint32_t magic; /* SAFETY_CHECKERS_GOLDEN_RETAIN_MAGIC while the region holds a sealed image */
+    uint32_t bootCount; /* Number of warm boots the image has been reused for */
+    uint32_t regionSize; /* Size of the region in 32-bit words */
+    uint32_t reserved; /* Reserved, zero */
+    uint64_t imageHdrSig; /* hdrSig of the golden image when it was sealed */
+    uint64_t retainSig; /* Signature of the fields above */
+} SafetyCheckers_GoldenRetainHdr;
+
+/**
+ *
+ * \brief   Golden images of the operating modes of an application, e.g. normal,
+ *          degraded and low power. Each image is validated when it is added;
+ *          switching the active mode only swaps the active image pointer.
+ *
+ */
+typedef struct
+{
+    const uint32_t *image[SAFETY_CHECKERS_GOLDEN_MODE_MAX]; /* Golden image of each mode, NULL when not added */
+    const uint32_t *activeImage; /* Golden image of the active mode, NULL before the first select */
+    uint32_t activeMode; /* Active mode, SAFETY_CHECKERS_GOLDEN_MODE_MAX before the first select */
+} SafetyCheckers_GoldenModeSet;
+
+/** @} */
+
+/**
+ * @ingroup GOLDEN_SAFETY_CHECKERS
+ *
+ * @defgroup SAFETY_CHECKERS_GOLDEN_API  SAFETY_CHECKERS_GOLDEN API definition
+ *  @{
+ */
+
+/* ========================================================================== */
+/*                          Function Declarations                             */
+/* ========================================================================== */
+
+/**
+ *  \brief    API to start a golden image in the memory pointed to by image.
+ *            The image shall be 8 byte aligned.
+ *
+ *  \param    image             [IN/OUT]       Pointer to the golden image memory
+ *  \param    size              [IN]           Size of the image memory in 32-bit words
+ *  \param    coreId            [IN]           Id of the core the image belongs to
+ *  \param    maxSections       [IN]           Number of directory entries to reserve
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_goldenInit(uint32_t *image, uint32_t size, uint32_t coreId, uint32_t maxSections);
+
+/**
+ *  \brief    API to add one section per PSC domain and one section per PLL with
+ *            the current register configuration.
+ *
+ *  \param    image             [IN/OUT]       Pointer to the golden image
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_goldenAddPm(uint32_t *image);
+
+/**
+ *  \brief    API to add one section per RM module with the current register
+ *            configuration.
+ *
+ *  \param    image             [IN/OUT]       Pointer to the golden image
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_goldenAddRm(uint32_t *image);
+
+/**
+ *  \brief    API to add one section per firewall of fwlConfig with the current
+ *            firewall register values. The firewall shall be opened with
+ *            SafetyCheckers_tifsReqFwlOpen before calling this API.
+ *
+ *  \param    image             [IN/OUT]       Pointer to the golden image
+ *  \param    fwlConfig         [IN]           Firewall ids and number of regions to read
+ *  \param    size              [IN]           Number of entries in fwlConfig
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_goldenAddTifs(uint32_t *image, const SafetyCheckers_TifsFwlConfig *fwlConfig, uint32_t size);
+
+/**
+ *  \brief    API to add a section with caller provided data, used for sections
+ *            such as the CSIRX register types that are read by the application.
+ *            Sections of one type shall be added one after the other, the
+ *            section index is the number of sections of that type added before.
+ *
+ *  \param    image             [IN/OUT]       Pointer to the golden image
+ *  \param    type              [IN]           Section type
+ *  \param    data              [IN]           Pointer to the section data
+ *  \param    count             [IN]           Number of 32-bit words of data
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_goldenAddSection(uint32_t *image, uint32_t type, const uint32_t *data, uint32_t count);
+
+/**
+ *  \brief    API to seal the golden image by computing the header signature.
+ *            The first hdr->imageSize bytes of the image can then be stored.
+ *
+ *  \param    image             [IN/OUT]       Pointer to the golden image
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_goldenFinish(uint32_t *image);
+
+/**
+ *  \brief    API to check that a golden image belongs to this SoC and library
+ *            register tables and that the header, directory and all section
+ *            signatures are intact. The per type first and count fields must
+ *            describe directory entries of that type in index order.
+ *
+ *  \param    image             [IN]           Pointer to the golden image
+ *  \param    size              [IN]           Size of the image memory in 32-bit words
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_goldenValidate(const uint32_t *image, uint32_t size);
+
+/**
+ *  \brief    API to locate one section of a validated golden image. The data
+ *            pointer points into the image, nothing is copied.
+ *
+ *  \param    image             [IN]           Pointer to the golden image
+ *  \param    type              [IN]           Section type
+ *  \param    index             [IN]           Section index within the type
+ *  \param    data              [IN/OUT]       Pointer to store the section data pointer
+ *  \param    count             [IN/OUT]       Pointer to store the number of data words
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_goldenGetSection(const uint32_t *image, uint32_t type, uint32_t index,
+                                        const uint32_t **data, uint32_t *count);
+
+/**
+ *  \brief    API to verify the registers of one PSC, PLL, RM or TIFS firewall
+ *            section of a validated golden image against the hardware.
+ *
+ *  \param    image             [IN]           Pointer to the golden image
+ *  \param    type              [IN]           Section type
+ *  \param    index             [IN]           Section index within the type
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_goldenVerifySection(const uint32_t *image, uint32_t type, uint32_t index);
+
+/**
+ *  \brief    API to verify all sections of the types selected in typeMask
+ *            against the hardware. CSIRX sections are not verified by this API,
+ *            the application passes them to SafetyCheckers_csirxVerifyRegCfg32.
+ *            TIFS sections need the firewall to be opened by the application.
+ *
+ *  \param    image             [IN]           Pointer to the golden image
+ *  \param    typeMask          [IN]           SAFETY_CHECKERS_GOLDEN_SEC_TYPE_MASK of the types to verify
+ *
+ *  \return   SAFETY_CHECKERS_SOK when all selected sections match,
+ *            SAFETY_CHECKERS_REG_DATA_MISMATCH when a section differs and no
+ *            other error occurred, else the first other failure, which stops
+ *            the verify.
+ *
+ */
+int32_t SafetyCheckers_goldenVerify(const uint32_t *image, uint32_t typeMask);
+
+/**
+ *  \brief    API to seal a golden image kept in a reset retained region. The
+ *            image is built in place at region + SAFETY_CHECKERS_GOLDEN_RETAIN_HDR_WORDS
+ *            and finished with SafetyCheckers_goldenFinish before this call.
+ *            The boot counter starts at zero.
+ *
+ *  \param    region            [IN/OUT]       Pointer to the retained region, 8 byte aligned
+ *  \param    size              [IN]           Size of the region in 32-bit words
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_goldenRetainSeal(uint32_t *region, uint32_t size);
+
+/**
+ *  \brief    API to reuse the golden image of a retained region at boot. The
+ *            image is only reused when the boot is an MCU warm reset
+ *            (SAFETY_CHECKERS_PM_WARM_RESET_MASK set in the reset source) and the
+ *            region header and the complete image validate. The boot counter is
+ *            then incremented. On any other boot the region is invalidated and
+ *            the application captures a new golden image, as it does after a
+ *            warm reset that finds no sealed region. A sealed retained image
+ *            that does not validate after a warm reset is a fault: it is
+ *            invalidated and shall not be re-captured from the live registers.
+ *
+ *  \param    region            [IN/OUT]       Pointer to the retained region, 8 byte aligned
+ *  \param    size              [IN]           Size of the region in 32-bit words
+ *  \param    image             [IN/OUT]       Pointer to store the golden image pointer
+ *  \param    bootCount         [IN/OUT]       Pointer to store the boot counter, can be NULL
+ *
+ *  \return   SAFETY_CHECKERS_SOK when the retained image can be used,
+ *            SAFETY_CHECKERS_REG_DATA_MISMATCH when the sealed retained image
+ *            does not validate after a warm reset, SAFETY_CHECKERS_FAIL when
+ *            there is no sealed retained image.
+ *
+ */
+int32_t SafetyCheckers_goldenRetainRestore(uint32_t *region, uint32_t size, const uint32_t **image,
+                                           uint32_t *bootCount);
+
+/**
+ *  \brief    API to invalidate a retained region, e.g. after a configuration
+ *            update, so the next warm boot captures a new golden image.
+ *
+ *  \param    region            [IN/OUT]       Pointer to the retained region
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_goldenRetainInvalidate(uint32_t *region);
+
+/**
+ *  \brief    API to clear a golden mode set
+ *
+ *  \param    modeSet           [IN/OUT]       Pointer to the golden mode set
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_goldenModeInit(SafetyCheckers_GoldenModeSet *modeSet);
+
+/**
+ *  \brief    API to add the golden image of an operating mode to a golden mode set,
+ *            typically at init time. The image is validated once here and shall
+ *            not be changed while it is part of the set.
+ *
+ *  \param    modeSet           [IN/OUT]       Pointer to the golden mode set
+ *  \param    mode              [IN]           Operating mode, less than SAFETY_CHECKERS_GOLDEN_MODE_MAX
+ *  \param    image             [IN]           Pointer to the finished golden image of the mode
+ *  \param    size              [IN]           Size of the image memory in 32-bit words
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_goldenModeAdd(SafetyCheckers_GoldenModeSet *modeSet, uint32_t mode,
+                                     const uint32_t *image, uint32_t size);
+
+/**
+ *  \brief    API to switch the active operating mode of a golden mode set. Only the
+ *            active image pointer is changed, no register is read.
+ *
+ *  \param    modeSet           [IN/OUT]       Pointer to the golden mode set
+ *  \param    mode              [IN]           Operating mode added with SafetyCheckers_goldenModeAdd
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_goldenModeSelect(SafetyCheckers_GoldenModeSet *modeSet, uint32_t mode);
+
+/**
+ *  \brief    API to get the golden image of the active operating mode, e.g. for
+ *            SafetyCheckers_goldenGetSection or SafetyCheckers_goldenVerifySection.
+ *
+ *  \param    modeSet           [IN]           Pointer to the golden mode set
+ *
+ *  \return   Golden image of the active mode, NULL when no mode is selected.
+ *
+ */
+const uint32_t *SafetyCheckers_goldenModeGetImage(const SafetyCheckers_GoldenModeSet *modeSet);
+
+/**
+ *  \brief    API to verify the selected section types against the golden image
+ *            of the active operating mode, see SafetyCheckers_goldenVerify.
+ *
+ *  \param    modeSet           [IN]           Pointer to the golden mode set
+ *  \param    typeMask          [IN]           SAFETY_CHECKERS_GOLDEN_SEC_TYPE_MASK of the types to verify
+ *
+ *  \return   SAFETY_CHECKERS_SOK when all selected sections match, else failure.
+ *
+ */
+int32_t SafetyCheckers_goldenModeVerify(const SafetyCheckers_GoldenModeSet *modeSet, uint32_t typeMask);
+
+/** @} */
+
+/* ========================================================================== */
+/*                       Static Function Definitions                          */
+/* ========================================================================== */
+
+/* None */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef SAFETY_CHECKERS_GOLDEN_H_ */
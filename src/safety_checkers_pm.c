@@ -43,6 +43,7 @@
 /* ========================================================================== */
 
 #include <stdint.h>
+#include <string.h>
 #include <cslr.h>
 #include <safety_checkers_pm.h>
 #include <safety_checkers_common.h>
@@ -64,13 +65,63 @@
 /*                          Function Declarations                             */
 /* ========================================================================== */
 
-/* None */
+static void SafetyCheckers_pmGetPscRegSetDesc(uint32_t index, SafetyCheckers_RegSetDesc *desc);
+static void SafetyCheckers_pmGetPllRegSetDesc(uint32_t index, SafetyCheckers_RegSetDesc *desc);
+static void SafetyCheckers_pmGetPscModuleTable(uint32_t psc, SafetyCheckers_RegSetTable *table);
+static void SafetyCheckers_pmGetPllModuleTable(uint32_t pll, SafetyCheckers_RegSetTable *table);
+static int32_t SafetyCheckers_pmPscSelCount(const SafetyCheckers_PmPscSel *pscSel, uint32_t *regCount);
+static int32_t SafetyCheckers_pmPscSelMaskCount(const uint32_t *mask, uint32_t numWords, uint32_t numReg,
+                                                uint32_t *regCount);
+static int32_t SafetyCheckers_pmCheckPscPdMap(const SafetyCheckers_PmPscPdMap *pdMap);
+static uint32_t SafetyCheckers_pmPscSelRead(uint32_t regAddr, const uint32_t *mask, uint32_t numWords,
+                                            uintptr_t *regCfg, const uintptr_t *goldenCfg, uint32_t *mismatchCnt);
+static uint32_t SafetyCheckers_pmGetAllPllMask(void);
+static uint32_t SafetyCheckers_pmGetPscCfgOffset(uint32_t psc);
+static uint32_t SafetyCheckers_pmPscBusy(uint32_t psc);
+static uint32_t SafetyCheckers_pmPscRegInFlight(uint32_t psc, uint32_t reg, uint32_t regVal);
+static int32_t SafetyCheckers_pmEventVerifyPsc(SafetyCheckers_PmEventCtx *eventCtx, uint32_t psc);
+static int32_t SafetyCheckers_pmGetPllCfgReg(uint32_t pll, const uintptr_t *pllRegCfg, uint32_t regOffset,
+                                             uint32_t *regVal);
 
 /* ========================================================================== */
 /*                            Global Variables                                */
 /* ========================================================================== */
 
-/* None */
+/* PD and MD stat register offsets, each PSC is a PD stat set followed by an MD stat set */
+static const uint32_t gSafetyCheckers_PmPscPdStatOffset[1U] = {SAFETY_CHECKERS_PM_PSC_PD_STAT_OFFSET};
+static const uint32_t gSafetyCheckers_PmPscMdStatOffset[1U] = {SAFETY_CHECKERS_PM_PSC_MD_STAT_OFFSET};
+
+/* Flat PSC and PLL address tables of the SoC header, each read as one register set */
+static const SafetyCheckers_RegSetDesc gSafetyCheckers_PmPscFlatDesc =
+{
+    0U, 0U, 1U, gSafetyCheckers_PmPscRegAddr, SAFETY_CHECKERS_PM_PSC_FLAT_NUM, SAFETY_CHECKERS_REGSET_MASK_ALL, 0U
+};
+static const SafetyCheckers_RegSetDesc gSafetyCheckers_PmPllFlatDesc =
+{
+    0U, 0U, 1U, gSafetyCheckers_PmPllRegAddr, SAFETY_CHECKERS_PM_PLL_FLAT_NUM, SAFETY_CHECKERS_REGSET_MASK_ALL, 0U
+};
+
+/* Whole PSC and PLL sweeps: one linear pass over the flat address tables */
+static const SafetyCheckers_RegSetTable gSafetyCheckers_PmPscFlatTable = {&gSafetyCheckers_PmPscFlatDesc, NULL, 0U, 1U};
+static const SafetyCheckers_RegSetTable gSafetyCheckers_PmPllFlatTable = {&gSafetyCheckers_PmPllFlatDesc, NULL, 0U, 1U};
+
+/* Register set table of every PSC, used for the per PSC APIs and the mismatch location */
+static const SafetyCheckers_RegSetTable gSafetyCheckers_PmPscRegSetTable =
+{
+    NULL,
+    SafetyCheckers_pmGetPscRegSetDesc,
+    0U,
+    (uint32_t)(2U * (sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData)))
+};
+
+/* Register set table of every PLL, used for the per PLL APIs and the mismatch location */
+static const SafetyCheckers_RegSetTable gSafetyCheckers_PmPllRegSetTable =
+{
+    NULL,
+    SafetyCheckers_pmGetPllRegSetDesc,
+    0U,
+    (uint32_t)(sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData))
+};
 
 /* ========================================================================== */
 /*                          Function Definitions                              */
@@ -81,166 +132,448 @@
  */
 int32_t SafetyCheckers_pmGetPscRegCfg(uintptr_t *pscRegCfg, uint32_t size)
 {
-    uint32_t md = 0U;
-    uint32_t pd = 0U;
+    return SafetyCheckers_regSetGetCfg(&gSafetyCheckers_PmPscFlatTable, pscRegCfg, (uint32_t)sizeof(uintptr_t), size);
+}
+
+int32_t SafetyCheckers_pmGetPscRegCfg32(uint32_t *pscRegCfg, uint32_t size)
+{
+    return SafetyCheckers_regSetGetCfg(&gSafetyCheckers_PmPscFlatTable, pscRegCfg, (uint32_t)sizeof(uint32_t), size);
+}
+
+/**
+ * Design: SAFETY_CHECKERS-250, SAFETY_CHECKERS-251
+ */
+int32_t SafetyCheckers_pmVerifyPscRegCfg(const uintptr_t *pscRegCfg, uint32_t size)
+{
+    return SafetyCheckers_regSetVerifyCfg(&gSafetyCheckers_PmPscFlatTable, pscRegCfg, (uint32_t)sizeof(uintptr_t), size);
+}
+
+int32_t SafetyCheckers_pmVerifyPscRegCfg32(const uint32_t *pscRegCfg, uint32_t size)
+{
+    return SafetyCheckers_regSetVerifyCfg(&gSafetyCheckers_PmPscFlatTable, pscRegCfg, (uint32_t)sizeof(uint32_t), size);
+}
+
+/**
+ * Design: SAFETY_CHECKERS-248
+ */
+int32_t SafetyCheckers_pmGetPllRegCfg(uintptr_t *pllRegCfg, uint32_t size)
+{
+    return SafetyCheckers_regSetGetCfg(&gSafetyCheckers_PmPllFlatTable, pllRegCfg, (uint32_t)sizeof(uintptr_t), size);
+}
+
+int32_t SafetyCheckers_pmGetPllRegCfg32(uint32_t *pllRegCfg, uint32_t size)
+{
+    return SafetyCheckers_regSetGetCfg(&gSafetyCheckers_PmPllFlatTable, pllRegCfg, (uint32_t)sizeof(uint32_t), size);
+}
+
+/**
+ * Design: SAFETY_CHECKERS-247, SAFETY_CHECKERS-251
+ */
+int32_t SafetyCheckers_pmVerifyPllRegCfg(const uintptr_t *pllRegCfg, uint32_t size)
+{
+    return SafetyCheckers_regSetVerifyCfg(&gSafetyCheckers_PmPllFlatTable, pllRegCfg, (uint32_t)sizeof(uintptr_t), size);
+}
+
+int32_t SafetyCheckers_pmVerifyPllRegCfg32(const uint32_t *pllRegCfg, uint32_t size)
+{
+    return SafetyCheckers_regSetVerifyCfg(&gSafetyCheckers_PmPllFlatTable, pllRegCfg, (uint32_t)sizeof(uint32_t), size);
+}
+
+int32_t SafetyCheckers_pmVerifyPscRegCfgSettle(const uintptr_t *pscRegCfg, uint32_t size,
+                                               SafetyCheckers_GetTimeUsecFxn getTimeUsec, uint64_t maxWaitUsec,
+                                               uint32_t *resampleCnt)
+{
+    uint32_t psc;
+    uint32_t reg;
+    uint32_t index;
+    uint32_t regVal;
+    uint32_t busyMask;
     uint32_t offset = 0U;
-    uint32_t totalLength = 0U;
-    uint32_t totalPSC;
+    uint32_t mismatchCnt = 0U;
+    uint32_t numFlight = 0U;
+    uint32_t numLeft;
+    uint64_t startTime = 0U;
+    uint32_t flightIdx[SAFETY_CHECKERS_PM_PSC_SETTLE_MAX];
+    uint32_t flightPsc[SAFETY_CHECKERS_PM_PSC_SETTLE_MAX];
     int32_t  status = SAFETY_CHECKERS_SOK;
 
-    /* Check if pscRegCfg is NULL */
-    if (pscRegCfg == NULL)
+    if ((pscRegCfg == NULL) || (getTimeUsec == NULL))
     {
         status = SAFETY_CHECKERS_FAIL;
     }
 
-    if(status == SAFETY_CHECKERS_SOK)
+    if ((status == SAFETY_CHECKERS_SOK) && (SAFETY_CHECKERS_PM_PSC_FLAT_NUM > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
     {
-        for (totalPSC = 0U; totalPSC < (sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData)); totalPSC++)
+        for (psc = 0U; psc < (sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData)); psc++)
         {
-            totalLength += (uint32_t)gSafetyCheckers_PmPscData[totalPSC].pdStat + gSafetyCheckers_PmPscData[totalPSC].mdStat;
+            for (reg = 0U; reg < (gSafetyCheckers_PmPscData[psc].pdStat + gSafetyCheckers_PmPscData[psc].mdStat); reg++)
+            {
+                regVal = (uint32_t)CSL_REG32_RD(gSafetyCheckers_PmPscRegAddr[offset + reg]);
+                if (SafetyCheckers_regCfgCompare(pscRegCfg, (uint32_t)sizeof(uintptr_t), offset + reg, regVal,
+                                                 SAFETY_CHECKERS_REGSET_MASK_ALL) != 0U)
+                {
+                    if ((numFlight < SAFETY_CHECKERS_PM_PSC_SETTLE_MAX) &&
+                        (SafetyCheckers_pmPscRegInFlight(psc, reg, regVal) != 0U))
+                    {
+                        flightIdx[numFlight] = offset + reg;
+                        flightPsc[numFlight] = psc;
+                        numFlight++;
+                    }
+                    else
+                    {
+                        mismatchCnt++;
+                    }
+                }
+            }
+            offset += gSafetyCheckers_PmPscData[psc].pdStat + gSafetyCheckers_PmPscData[psc].mdStat;
         }
 
-        if (totalLength > size)
+        if (resampleCnt != NULL)
         {
-            /* Check for the buffer size */
-            status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+            *resampleCnt = numFlight;
         }
-    }
 
-    if(status == SAFETY_CHECKERS_SOK)
-    {
-        for (totalPSC = 0U; totalPSC < (sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData)); totalPSC++)
+        /* Re-sample only the in-flight registers, once their PSCs are settled */
+        startTime = getTimeUsec();
+        while ((numFlight != 0U) && ((getTimeUsec() - startTime) < maxWaitUsec))
         {
-            for(pd = 0U; pd < (gSafetyCheckers_PmPscData[totalPSC].pdStat); pd++)
+            busyMask = 0U;
+            for (index = 0U; index < numFlight; index++)
             {
-                pscRegCfg[offset] = (uintptr_t)CSL_REG32_RD((gSafetyCheckers_PmPscData[totalPSC].baseAddr + SAFETY_CHECKERS_PM_PSC_PD_STAT_OFFSET) + (0x4U * pd));
-                offset++;
+                if (((busyMask & (1U << flightPsc[index])) == 0U) && (SafetyCheckers_pmPscBusy(flightPsc[index]) != 0U))
+                {
+                    busyMask |= (1U << flightPsc[index]);
+                }
             }
 
-            for(md = 0U; md < (gSafetyCheckers_PmPscData[totalPSC].mdStat); md++)
+            numLeft = 0U;
+            for (index = 0U; index < numFlight; index++)
             {
-                pscRegCfg[offset] = (uintptr_t)CSL_REG32_RD((gSafetyCheckers_PmPscData[totalPSC].baseAddr + SAFETY_CHECKERS_PM_PSC_MD_STAT_OFFSET) + (0x4U * md));
-                offset++;
+                if ((busyMask & (1U << flightPsc[index])) != 0U)
+                {
+                    /* Transition still in progress, keep it for the next wait */
+                    flightIdx[numLeft] = flightIdx[index];
+                    flightPsc[numLeft] = flightPsc[index];
+                    numLeft++;
+                }
+                else
+                {
+                    regVal = (uint32_t)CSL_REG32_RD(gSafetyCheckers_PmPscRegAddr[flightIdx[index]]);
+                    if (SafetyCheckers_regCfgCompare(pscRegCfg, (uint32_t)sizeof(uintptr_t), flightIdx[index], regVal,
+                                                     SAFETY_CHECKERS_REGSET_MASK_ALL) != 0U)
+                    {
+                        if (SafetyCheckers_pmPscRegInFlight(flightPsc[index],
+                                                            flightIdx[index] - SafetyCheckers_pmGetPscCfgOffset(flightPsc[index]),
+                                                            regVal) != 0U)
+                        {
+                            flightIdx[numLeft] = flightIdx[index];
+                            flightPsc[numLeft] = flightPsc[index];
+                            numLeft++;
+                        }
+                        else
+                        {
+                            mismatchCnt++;
+                        }
+                    }
+                }
             }
+            numFlight = numLeft;
+        }
+
+        /* Still in flight when the wait ran out */
+        mismatchCnt += numFlight;
+
+        if (mismatchCnt != 0U)
+        {
+            status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
         }
     }
 
     return (status);
 }
 
-/**
- * Design: SAFETY_CHECKERS-250, SAFETY_CHECKERS-251
- */
-int32_t SafetyCheckers_pmVerifyPscRegCfg(const uintptr_t *pscRegCfg, uint32_t size)
+uint32_t SafetyCheckers_pmGetPscSelRegCount(const SafetyCheckers_PmPscSel *pscSel)
+{
+    uint32_t regCount = 0U;
+
+    if (SafetyCheckers_pmPscSelCount(pscSel, &regCount) != SAFETY_CHECKERS_SOK)
+    {
+        regCount = 0U;
+    }
+
+    return regCount;
+}
+
+int32_t SafetyCheckers_pmGetPscSelRegCfg(const SafetyCheckers_PmPscSel *pscSel, uintptr_t *pscRegCfg,
+                                         uint32_t size)
+{
+    uint32_t index;
+    uint32_t regCount = 0U;
+    uint32_t offset = 0U;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (pscRegCfg == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        status = SafetyCheckers_pmPscSelCount(pscSel, &regCount);
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (regCount > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        for (index = 0U; index < (sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData)); index++)
+        {
+            offset += SafetyCheckers_pmPscSelRead(gSafetyCheckers_PmPscData[index].baseAddr + SAFETY_CHECKERS_PM_PSC_PD_STAT_OFFSET,
+                                                  pscSel[index].pdMask, SAFETY_CHECKERS_PM_PSC_SEL_PD_MAX / 32U,
+                                                  &pscRegCfg[offset], NULL, NULL);
+            offset += SafetyCheckers_pmPscSelRead(gSafetyCheckers_PmPscData[index].baseAddr + SAFETY_CHECKERS_PM_PSC_MD_STAT_OFFSET,
+                                                  pscSel[index].mdMask, SAFETY_CHECKERS_PM_PSC_SEL_MD_MAX / 32U,
+                                                  &pscRegCfg[offset], NULL, NULL);
+        }
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_pmVerifyPscSelRegCfg(const SafetyCheckers_PmPscSel *pscSel, const uintptr_t *pscRegCfg,
+                                            uint32_t size)
 {
-    uint32_t md = 0U;
-    uint32_t pd = 0U;
+    uint32_t index;
+    uint32_t regCount = 0U;
     uint32_t offset = 0U;
-    uint32_t totalLength = 0U;
-    uint32_t readData = 0U;
     uint32_t mismatchCnt = 0U;
-    uint32_t totalPSC;
     int32_t  status = SAFETY_CHECKERS_SOK;
 
-    /* Check if pscRegCfg is NULL */
     if (pscRegCfg == NULL)
     {
         status = SAFETY_CHECKERS_FAIL;
     }
 
-    if(status == SAFETY_CHECKERS_SOK)
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        status = SafetyCheckers_pmPscSelCount(pscSel, &regCount);
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (regCount > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
     {
-        for (totalPSC = 0U; totalPSC < (sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData)); totalPSC++)
+        for (index = 0U; index < (sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData)); index++)
         {
-            totalLength += (uint32_t)gSafetyCheckers_PmPscData[totalPSC].pdStat + gSafetyCheckers_PmPscData[totalPSC].mdStat;
+            offset += SafetyCheckers_pmPscSelRead(gSafetyCheckers_PmPscData[index].baseAddr + SAFETY_CHECKERS_PM_PSC_PD_STAT_OFFSET,
+                                                  pscSel[index].pdMask, SAFETY_CHECKERS_PM_PSC_SEL_PD_MAX / 32U,
+                                                  NULL, &pscRegCfg[offset], &mismatchCnt);
+            offset += SafetyCheckers_pmPscSelRead(gSafetyCheckers_PmPscData[index].baseAddr + SAFETY_CHECKERS_PM_PSC_MD_STAT_OFFSET,
+                                                  pscSel[index].mdMask, SAFETY_CHECKERS_PM_PSC_SEL_MD_MAX / 32U,
+                                                  NULL, &pscRegCfg[offset], &mismatchCnt);
         }
 
-        if (totalLength > size)
+        if (mismatchCnt != 0U)
         {
-            /* Check for the buffer size */
-            status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+            status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
         }
     }
 
-    if(status == SAFETY_CHECKERS_SOK)
+    return (status);
+}
+
+int32_t SafetyCheckers_pmVerifyPscRegCfgPdAware(const uintptr_t *pscRegCfg, uint32_t size,
+                                                const SafetyCheckers_PmPscPdMap *pdMap, uint32_t *skipCnt)
+{
+    uint32_t index;
+    uint32_t regNum;
+    uint32_t pd;
+    uint32_t offset = 0U;
+    uint32_t skipped = 0U;
+    uint32_t mismatchCnt = 0U;
+    uint32_t readData;
+    uint64_t pdOff;
+    const SafetyCheckers_PmPscData *pscData;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (pscRegCfg == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
     {
-        for (totalPSC = 0U; totalPSC < (sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData)); totalPSC++)
-        {
-            for(pd = 0U; pd < (gSafetyCheckers_PmPscData[totalPSC].pdStat); pd++)
-            {
-                readData = (uint32_t)CSL_REG32_RD((gSafetyCheckers_PmPscData[totalPSC].baseAddr + SAFETY_CHECKERS_PM_PSC_PD_STAT_OFFSET) + (0x4U * pd));
+        status = SafetyCheckers_pmCheckPscPdMap(pdMap);
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (SAFETY_CHECKERS_PM_PSC_FLAT_NUM > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
 
-                mismatchCnt |= pscRegCfg[offset] ^ readData;
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        for (index = 0U; index < (sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData)); index++)
+        {
+            pscData = &gSafetyCheckers_PmPscData[index];
+            pdOff = 0U;
 
+            /* PD stat registers first, recording the powered off domains */
+            for (regNum = 0U; regNum < pscData->pdStat; regNum++)
+            {
+                readData = (uint32_t)CSL_REG32_RD(pscData->baseAddr + SAFETY_CHECKERS_PM_PSC_PD_STAT_OFFSET + (4U * regNum));
+                mismatchCnt |= SafetyCheckers_regCfgCompare(pscRegCfg, (uint32_t)sizeof(uintptr_t), offset,
+                                                            readData, SAFETY_CHECKERS_REGSET_MASK_ALL);
                 offset++;
+                if (((readData & SAFETY_CHECKERS_PM_PSC_PD_STAT_STATE_MASK) == SAFETY_CHECKERS_PM_PSC_PD_STAT_STATE_OFF) &&
+                    (regNum < SAFETY_CHECKERS_PM_PSC_SEL_PD_MAX))
+                {
+                    pdOff |= ((uint64_t)1U << regNum);
+                }
             }
 
-            for(md = 0U; md < (gSafetyCheckers_PmPscData[totalPSC].mdStat); md++)
+            /* MD stat registers of the LPSCs in a powered on (or no) domain */
+            for (regNum = 0U; regNum < pscData->mdStat; regNum++)
             {
-                readData = (uint32_t)CSL_REG32_RD((gSafetyCheckers_PmPscData[totalPSC].baseAddr + SAFETY_CHECKERS_PM_PSC_MD_STAT_OFFSET) + (0x4U * md));
-
-                mismatchCnt |= (uint32_t)(pscRegCfg[offset] ^ readData);
+                pd = SAFETY_CHECKERS_PM_PSC_PD_NONE;
+                if (pdMap[index].lpscPd != NULL)
+                {
+                    pd = (uint32_t)pdMap[index].lpscPd[regNum];
+                }
 
+                if ((pd != SAFETY_CHECKERS_PM_PSC_PD_NONE) && ((pdOff & ((uint64_t)1U << pd)) != 0U))
+                {
+                    skipped++;
+                }
+                else
+                {
+                    readData = (uint32_t)CSL_REG32_RD(pscData->baseAddr + SAFETY_CHECKERS_PM_PSC_MD_STAT_OFFSET + (4U * regNum));
+                    mismatchCnt |= SafetyCheckers_regCfgCompare(pscRegCfg, (uint32_t)sizeof(uintptr_t), offset,
+                                                                readData, SAFETY_CHECKERS_REGSET_MASK_ALL);
+                }
                 offset++;
             }
         }
-        if(mismatchCnt != 0U)
+
+        if (mismatchCnt != 0U)
         {
             status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
         }
     }
 
+    if (skipCnt != NULL)
+    {
+        *skipCnt = skipped;
+    }
+
     return (status);
 }
 
-/**
- * Design: SAFETY_CHECKERS-248
- */
-int32_t SafetyCheckers_pmGetPllRegCfg(uintptr_t *pllRegCfg, uint32_t size)
+int32_t SafetyCheckers_pmDecodePllFreq(uint32_t pll, const uintptr_t *pllRegCfg, uint32_t size,
+                                       uint32_t refFreqHz, SafetyCheckers_PmPllFreq *pllFreq)
 {
-    uint32_t offset = 0U;
-    uint32_t totalLength = 0U;
-    uint32_t length;
-    uint32_t pllLength;
+    uint32_t regNum;
+    uint32_t regOffset;
+    uint32_t hsdiv;
+    uint32_t ctrl = 0U;
+    uint32_t stat = 0U;
+    uint32_t freqCtrl0 = 0U;
+    uint32_t freqCtrl1 = 0U;
+    uint32_t divCtrl = 0U;
+    uint32_t refDiv;
+    uint32_t postDiv1;
+    uint32_t postDiv2;
     int32_t  status = SAFETY_CHECKERS_SOK;
 
-    /* Check if pllRegCfg is NULL */
-    if (pllRegCfg == NULL)
+    if ((pllRegCfg == NULL) || (pllFreq == NULL) ||
+        (pll >= (sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData))))
     {
         status = SAFETY_CHECKERS_FAIL;
     }
 
-    if(status == SAFETY_CHECKERS_SOK)
+    if ((status == SAFETY_CHECKERS_SOK) && (SAFETY_CHECKERS_PM_PLL_FLAT_NUM > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+
+    /* Only a PLL_16FFT has all of the control registers in its register set */
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        status = SafetyCheckers_pmGetPllCfgReg(pll, pllRegCfg, SAFETY_CHECKERS_PM_PLL_CTRL_OFFSET, &ctrl);
+    }
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        status = SafetyCheckers_pmGetPllCfgReg(pll, pllRegCfg, SAFETY_CHECKERS_PM_PLL_STAT_OFFSET, &stat);
+    }
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        status = SafetyCheckers_pmGetPllCfgReg(pll, pllRegCfg, SAFETY_CHECKERS_PM_PLL_FREQ_CTRL0_OFFSET, &freqCtrl0);
+    }
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        status = SafetyCheckers_pmGetPllCfgReg(pll, pllRegCfg, SAFETY_CHECKERS_PM_PLL_FREQ_CTRL1_OFFSET, &freqCtrl1);
+    }
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        status = SafetyCheckers_pmGetPllCfgReg(pll, pllRegCfg, SAFETY_CHECKERS_PM_PLL_DIV_CTRL_OFFSET, &divCtrl);
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
     {
-        for (length = 0U; length < (sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData)); length++)
+        pllFreq->bypass = ((ctrl & SAFETY_CHECKERS_PM_PLL_CTRL_BYPASS_EN) != 0U) ? 1U : 0U;
+        pllFreq->locked = ((pllFreq->bypass != 0U) || ((stat & SAFETY_CHECKERS_PM_PLL_STAT_LOCK) != 0U)) ? 1U : 0U;
+        for (hsdiv = 0U; hsdiv < SAFETY_CHECKERS_PM_PLL_HSDIV_MAX; hsdiv++)
         {
-            pllLength = 0U;
-            while((gSafetyCheckers_PmPllData[length].length) != gSafetyCheckers_PmPllData[length].regOffsetArr[pllLength])
-		    {
-                pllLength++;
-                totalLength++;
-            }
+            pllFreq->hsdivFreqHz[hsdiv] = 0U;
         }
 
-        /* Check for the buffer size */
-        if (totalLength > size)
+        refDiv   = divCtrl & SAFETY_CHECKERS_PM_PLL_REF_DIV_MASK;
+        postDiv1 = (divCtrl >> SAFETY_CHECKERS_PM_PLL_POST_DIV1_SHIFT) & SAFETY_CHECKERS_PM_PLL_POST_DIV_MASK;
+        postDiv2 = (divCtrl >> SAFETY_CHECKERS_PM_PLL_POST_DIV2_SHIFT) & SAFETY_CHECKERS_PM_PLL_POST_DIV_MASK;
+
+        if (pllFreq->bypass != 0U)
+        {
+            pllFreq->vcoFreqHz     = (uint64_t)refFreqHz;
+            pllFreq->postDivFreqHz = (uint64_t)refFreqHz;
+        }
+        else if ((refDiv == 0U) || (postDiv1 == 0U) || (postDiv2 == 0U))
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+        else
         {
-            status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+            /* Integer and fractional feedback parts are scaled separately to stay in 64 bits */
+            pllFreq->vcoFreqHz = ((uint64_t)refFreqHz * (uint64_t)(freqCtrl0 & SAFETY_CHECKERS_PM_PLL_FB_DIV_INT_MASK)) +
+                                 (((uint64_t)refFreqHz * (uint64_t)(freqCtrl1 & SAFETY_CHECKERS_PM_PLL_FB_DIV_FRAC_MASK)) >>
+                                  SAFETY_CHECKERS_PM_PLL_FB_DIV_FRAC_BITS);
+            pllFreq->vcoFreqHz     = pllFreq->vcoFreqHz / (uint64_t)refDiv;
+            pllFreq->postDivFreqHz = pllFreq->vcoFreqHz / ((uint64_t)postDiv1 * (uint64_t)postDiv2);
         }
     }
 
-    if(status == SAFETY_CHECKERS_SOK)
+    if (status == SAFETY_CHECKERS_SOK)
     {
-        for (length = 0U; length < (sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData)); length++)
+        for (regNum = gSafetyCheckers_PmPllRegIndex[pll]; regNum < gSafetyCheckers_PmPllRegIndex[pll + 1U]; regNum++)
         {
-		    pllLength = 0U;
-            while((gSafetyCheckers_PmPllData[length].length) != gSafetyCheckers_PmPllData[length].regOffsetArr[pllLength])
-		    {
-			    pllRegCfg[offset] = (uintptr_t)CSL_REG32_RD((gSafetyCheckers_PmPllData[length].baseAddr) + gSafetyCheckers_PmPllData[length].regOffsetArr[pllLength]);
-
-                offset++;
-			    pllLength++;
+            regOffset = gSafetyCheckers_PmPllData[pll].regOffsetArr[regNum - gSafetyCheckers_PmPllRegIndex[pll]];
+            if ((regOffset >= SAFETY_CHECKERS_PM_PLL_HSDIV_CTRL_OFFSET) &&
+                (regOffset < (SAFETY_CHECKERS_PM_PLL_HSDIV_CTRL_OFFSET + (4U * SAFETY_CHECKERS_PM_PLL_HSDIV_MAX))) &&
+                (((uint32_t)pllRegCfg[regNum] & SAFETY_CHECKERS_PM_PLL_HSDIV_CLKOUT_EN) != 0U))
+            {
+                hsdiv = (regOffset - SAFETY_CHECKERS_PM_PLL_HSDIV_CTRL_OFFSET) / 4U;
+                pllFreq->hsdivFreqHz[hsdiv] = pllFreq->vcoFreqHz /
+                                              (uint64_t)(((uint32_t)pllRegCfg[regNum] & SAFETY_CHECKERS_PM_PLL_HSDIV_DIV_MASK) + 1U);
             }
         }
     }
@@ -248,99 +581,1002 @@ int32_t SafetyCheckers_pmGetPllRegCfg(uintptr_t *pllRegCfg, uint32_t size)
     return (status);
 }
 
-/**
- * Design: SAFETY_CHECKERS-247, SAFETY_CHECKERS-251
- */
-int32_t SafetyCheckers_pmVerifyPllRegCfg(const uintptr_t *pllRegCfg, uint32_t size)
+int32_t SafetyCheckers_pmVerifyPllFreq(const uintptr_t *pllRegCfg, uint32_t size,
+                                       const SafetyCheckers_PmPllFreqRange *freqRange, uint32_t numRange)
 {
-    uint32_t offset = 0U;
-    uint32_t totalLength = 0U;
-    uint32_t readData = 0U;
+    uint32_t index;
     uint32_t mismatchCnt = 0U;
-    uint32_t length;
-    uint32_t pllLength;
+    uint64_t freqHz = 0U;
+    SafetyCheckers_PmPllFreq pllFreq;
     int32_t  status = SAFETY_CHECKERS_SOK;
 
-    /* Check if pllRegCfg is NULL */
-    if (pllRegCfg == NULL)
+    if (freqRange == NULL)
     {
         status = SAFETY_CHECKERS_FAIL;
     }
 
-    if(status == SAFETY_CHECKERS_SOK)
+    for (index = 0U; (status == SAFETY_CHECKERS_SOK) && (index < numRange); index++)
     {
-        for (length = 0U; length < (sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData)); length++)
+        status = SafetyCheckers_pmDecodePllFreq(freqRange[index].pll, pllRegCfg, size,
+                                                freqRange[index].refFreqHz, &pllFreq);
+        if (status == SAFETY_CHECKERS_SOK)
         {
-            pllLength = 0U;
-            while((gSafetyCheckers_PmPllData[length].length) != gSafetyCheckers_PmPllData[length].regOffsetArr[pllLength])
-		    {
-                pllLength++;
-                totalLength++;
+            if (freqRange[index].output == SAFETY_CHECKERS_PM_PLL_OUT_VCO)
+            {
+                freqHz = pllFreq.vcoFreqHz;
+            }
+            else if (freqRange[index].output == SAFETY_CHECKERS_PM_PLL_OUT_POSTDIV)
+            {
+                freqHz = pllFreq.postDivFreqHz;
+            }
+            else if (freqRange[index].output < SAFETY_CHECKERS_PM_PLL_HSDIV_MAX)
+            {
+                freqHz = pllFreq.hsdivFreqHz[freqRange[index].output];
+            }
+            else
+            {
+                status = SAFETY_CHECKERS_FAIL;
             }
         }
 
-        if (totalLength > size)
+        if ((status == SAFETY_CHECKERS_SOK) &&
+            ((pllFreq.locked == 0U) || (freqHz < freqRange[index].minFreqHz) || (freqHz > freqRange[index].maxFreqHz)))
         {
-            /* Check for the buffer size */
-            status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+            mismatchCnt++;
         }
     }
 
-    if(status == SAFETY_CHECKERS_SOK)
+    if ((status == SAFETY_CHECKERS_SOK) && (mismatchCnt != 0U))
     {
-        for (length = 0U; length < (sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData)); length++)
-        {
-		    pllLength = 0U;
-		    while ((gSafetyCheckers_PmPllData[length].length) != gSafetyCheckers_PmPllData[length].regOffsetArr[pllLength])
-            {
-                readData = (uint32_t)CSL_REG32_RD((gSafetyCheckers_PmPllData[length].baseAddr) + gSafetyCheckers_PmPllData[length].regOffsetArr[pllLength]);
+        status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
+    }
 
-                mismatchCnt |= (uint32_t)(pllRegCfg[offset] ^ readData);
+    return (status);
+}
 
-                offset++;
-			    pllLength++;
-            }
-        }
+int32_t SafetyCheckers_pmUpdatePllRegCfg(uint32_t pll, uintptr_t *pllRegCfg, uint32_t size)
+{
+    SafetyCheckers_RegSetTable table;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((pllRegCfg == NULL) || (pll >= (sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData))))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (SAFETY_CHECKERS_PM_PLL_FLAT_NUM > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
 
-        if(mismatchCnt != 0U)
-	    {
-		    status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
-	    }
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        /* Only the registers of this PLL, at their place in the whole configuration */
+        SafetyCheckers_pmGetPllModuleTable(pll, &table);
+        status = SafetyCheckers_regSetGetCfg(&table, &pllRegCfg[gSafetyCheckers_PmPllRegIndex[pll]],
+                                             (uint32_t)sizeof(uintptr_t), size - gSafetyCheckers_PmPllRegIndex[pll]);
     }
 
     return (status);
 }
 
-/**
- * Design: SAFETY_CHECKERS-246, SAFETY_CHECKERS-251
- */
-int32_t SafetyCheckers_pmRegisterLock(void)
+int32_t SafetyCheckers_pmUpdatePscRegCfg(uint32_t psc, uint32_t lpsc, const SafetyCheckers_PmPscPdMap *pdMap,
+                                         uintptr_t *pscRegCfg, uint32_t size)
 {
-    uint32_t index;
-    uint32_t lockStat;
-    uint32_t pllLockCnt = 0U;
-    int32_t  status = SAFETY_CHECKERS_FAIL;
+    uint32_t offset = 0U;
+    uint32_t pd = SAFETY_CHECKERS_PM_PSC_PD_NONE;
+    const SafetyCheckers_PmPscData *pscData = NULL;
+    int32_t  status = SAFETY_CHECKERS_SOK;
 
-    for (index = 0U; index < (sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData)); index++)
+    if ((pscRegCfg == NULL) || (psc >= (sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData))))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+    else
     {
-        /* Lock the PLL register access */
-        CSL_REG32_WR((gSafetyCheckers_PmPllData[index].baseAddr + SAFETY_CHECKERS_PM_LOCK_KEY0_OFFSET), SAFETY_CHECKERS_PM_KICK_LOCK);
-        CSL_REG32_WR((gSafetyCheckers_PmPllData[index].baseAddr + SAFETY_CHECKERS_PM_LOCK_KEY1_OFFSET), SAFETY_CHECKERS_PM_KICK_LOCK);
+        pscData = &gSafetyCheckers_PmPscData[psc];
+        if (lpsc >= pscData->mdStat)
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+    }
 
-        /* Confirm the PLL registers are locked */
-        lockStat = (uint32_t)CSL_REG32_RD(gSafetyCheckers_PmPllData[index].baseAddr + SAFETY_CHECKERS_PM_LOCK_KEY0_OFFSET);
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        status = SafetyCheckers_pmCheckPscPdMap(pdMap);
+    }
 
-        /* check for PLL lock confirmation*/
-        if((lockStat & 0x1U) == 0x0U)
+    if ((status == SAFETY_CHECKERS_SOK) && (SAFETY_CHECKERS_PM_PSC_FLAT_NUM > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        offset = SafetyCheckers_pmGetPscCfgOffset(psc);
+
+        /* PD stat register of the domain owning the LPSC, then the MD stat register of the LPSC */
+        if (pdMap[psc].lpscPd != NULL)
+        {
+            pd = (uint32_t)pdMap[psc].lpscPd[lpsc];
+        }
+
+        if (pd != SAFETY_CHECKERS_PM_PSC_PD_NONE)
         {
-            pllLockCnt = (uint32_t)(pllLockCnt) + 1U;
+            pscRegCfg[offset + pd] =
+                (uintptr_t)CSL_REG32_RD(pscData->baseAddr + SAFETY_CHECKERS_PM_PSC_PD_STAT_OFFSET + (4U * pd));
         }
+
+        pscRegCfg[offset + pscData->pdStat + lpsc] =
+            (uintptr_t)CSL_REG32_RD(pscData->baseAddr + SAFETY_CHECKERS_PM_PSC_MD_STAT_OFFSET + (4U * lpsc));
     }
 
-    if(pllLockCnt == (sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData)))
+    return (status);
+}
+
+uint32_t SafetyCheckers_pmGetNumPsc(void)
+{
+    return (uint32_t)(sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData));
+}
+
+uint32_t SafetyCheckers_pmGetNumPll(void)
+{
+    return (uint32_t)(sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData));
+}
+
+uint32_t SafetyCheckers_pmGetPscModuleRegCount(uint32_t psc)
+{
+    uint32_t regCount = 0U;
+    SafetyCheckers_RegSetTable table;
+
+    if (psc < (sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData)))
     {
-        status = SAFETY_CHECKERS_SOK;
+        SafetyCheckers_pmGetPscModuleTable(psc, &table);
+        regCount = SafetyCheckers_regSetGetCount(&table);
+    }
+
+    return regCount;
+}
+
+uint32_t SafetyCheckers_pmGetPllModuleRegCount(uint32_t pll)
+{
+    uint32_t regCount = 0U;
+    SafetyCheckers_RegSetTable table;
+
+    if (pll < (sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData)))
+    {
+        SafetyCheckers_pmGetPllModuleTable(pll, &table);
+        regCount = SafetyCheckers_regSetGetCount(&table);
+    }
+
+    return regCount;
+}
+
+int32_t SafetyCheckers_pmGetPscModuleRegCfg32(uint32_t psc, uint32_t *regCfg, uint32_t size)
+{
+    SafetyCheckers_RegSetTable table;
+    int32_t  status = SAFETY_CHECKERS_FAIL;
+
+    if (psc < (sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData)))
+    {
+        SafetyCheckers_pmGetPscModuleTable(psc, &table);
+        status = SafetyCheckers_regSetGetCfg(&table, regCfg, (uint32_t)sizeof(uint32_t), size);
     }
 
     return (status);
 }
+
+int32_t SafetyCheckers_pmVerifyPscModuleRegCfg32(uint32_t psc, const uint32_t *regCfg, uint32_t size)
+{
+    SafetyCheckers_RegSetTable table;
+    int32_t  status = SAFETY_CHECKERS_FAIL;
+
+    if (psc < (sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData)))
+    {
+        SafetyCheckers_pmGetPscModuleTable(psc, &table);
+        status = SafetyCheckers_regSetVerifyCfg(&table, regCfg, (uint32_t)sizeof(uint32_t), size);
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_pmGetPllModuleRegCfg32(uint32_t pll, uint32_t *regCfg, uint32_t size)
+{
+    SafetyCheckers_RegSetTable table;
+    int32_t  status = SAFETY_CHECKERS_FAIL;
+
+    if (pll < (sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData)))
+    {
+        SafetyCheckers_pmGetPllModuleTable(pll, &table);
+        status = SafetyCheckers_regSetGetCfg(&table, regCfg, (uint32_t)sizeof(uint32_t), size);
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_pmVerifyPllModuleRegCfg32(uint32_t pll, const uint32_t *regCfg, uint32_t size)
+{
+    SafetyCheckers_RegSetTable table;
+    int32_t  status = SAFETY_CHECKERS_FAIL;
+
+    if (pll < (sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData)))
+    {
+        SafetyCheckers_pmGetPllModuleTable(pll, &table);
+        status = SafetyCheckers_regSetVerifyCfg(&table, regCfg, (uint32_t)sizeof(uint32_t), size);
+    }
+
+    return (status);
+}
+
+uint64_t SafetyCheckers_pmGetTableSig(void)
+{
+    uint32_t index;
+    uint32_t pllLength;
+    uint64_t sig = SAFETY_CHECKERS_SIG_SEED;
+
+    for (index = 0U; index < (sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData)); index++)
+    {
+        sig = SafetyCheckers_sigUpdate(sig, gSafetyCheckers_PmPscData[index].baseAddr);
+        sig = SafetyCheckers_sigUpdate(sig, gSafetyCheckers_PmPscData[index].pdStat);
+        sig = SafetyCheckers_sigUpdate(sig, gSafetyCheckers_PmPscData[index].mdStat);
+    }
+
+    for (index = 0U; index < (sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData)); index++)
+    {
+        sig = SafetyCheckers_sigUpdate(sig, gSafetyCheckers_PmPllData[index].baseAddr);
+        for (pllLength = 0U; pllLength < (gSafetyCheckers_PmPllRegIndex[index + 1U] - gSafetyCheckers_PmPllRegIndex[index]); pllLength++)
+        {
+            sig = SafetyCheckers_sigUpdate(sig, gSafetyCheckers_PmPllData[index].regOffsetArr[pllLength]);
+        }
+    }
+
+    return sig;
+}
+
+int32_t SafetyCheckers_pmGetPscRegSigTree(uint64_t *pscSigTree, uint32_t size)
+{
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (pscSigTree == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (SAFETY_CHECKERS_SIG_TREE_SIZE > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        SafetyCheckers_regSetBuildSigTree(&gSafetyCheckers_PmPscFlatTable, pscSigTree,
+                                          SafetyCheckers_regSetGetCount(&gSafetyCheckers_PmPscFlatTable));
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_pmVerifyPscRegSigTree(const uint64_t *pscSigTree, uint64_t *pscSigTreeWork,
+                                           uint32_t size, SafetyCheckers_SigMismatch *mismatch)
+{
+    uint32_t totalReg;
+    uint32_t firstReg = 0U;
+    uint32_t regCount = 0U;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((pscSigTree == NULL) || (pscSigTreeWork == NULL))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (SAFETY_CHECKERS_SIG_TREE_SIZE > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        totalReg = SafetyCheckers_regSetGetCount(&gSafetyCheckers_PmPscFlatTable);
+        SafetyCheckers_regSetBuildSigTree(&gSafetyCheckers_PmPscFlatTable, pscSigTreeWork, totalReg);
+
+        status = SafetyCheckers_sigTreeCompare(pscSigTree, pscSigTreeWork, totalReg, &firstReg, &regCount);
+
+        if ((status == SAFETY_CHECKERS_REG_DATA_MISMATCH) && (mismatch != NULL))
+        {
+            SafetyCheckers_regSetGetLocation(&gSafetyCheckers_PmPscRegSetTable, firstReg, mismatch);
+            mismatch->regCount = regCount;
+        }
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_pmGetPllRegSigTree(uint64_t *pllSigTree, uint32_t size)
+{
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (pllSigTree == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (SAFETY_CHECKERS_SIG_TREE_SIZE > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        SafetyCheckers_regSetBuildSigTree(&gSafetyCheckers_PmPllFlatTable, pllSigTree,
+                                          SafetyCheckers_regSetGetCount(&gSafetyCheckers_PmPllFlatTable));
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_pmVerifyPllRegSigTree(const uint64_t *pllSigTree, uint64_t *pllSigTreeWork,
+                                           uint32_t size, SafetyCheckers_SigMismatch *mismatch)
+{
+    uint32_t totalReg;
+    uint32_t firstReg = 0U;
+    uint32_t regCount = 0U;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((pllSigTree == NULL) || (pllSigTreeWork == NULL))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (SAFETY_CHECKERS_SIG_TREE_SIZE > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        totalReg = SafetyCheckers_regSetGetCount(&gSafetyCheckers_PmPllFlatTable);
+        SafetyCheckers_regSetBuildSigTree(&gSafetyCheckers_PmPllFlatTable, pllSigTreeWork, totalReg);
+
+        status = SafetyCheckers_sigTreeCompare(pllSigTree, pllSigTreeWork, totalReg, &firstReg, &regCount);
+
+        if ((status == SAFETY_CHECKERS_REG_DATA_MISMATCH) && (mismatch != NULL))
+        {
+            SafetyCheckers_regSetGetLocation(&gSafetyCheckers_PmPllRegSetTable, firstReg, mismatch);
+            mismatch->regCount = regCount;
+        }
+    }
+
+    return (status);
+}
+
+/**
+ * Design: SAFETY_CHECKERS-246, SAFETY_CHECKERS-251
+ */
+int32_t SafetyCheckers_pmRegisterLock(void)
+{
+    return SafetyCheckers_pmRegisterLockMask(SafetyCheckers_pmGetAllPllMask(), NULL);
+}
+
+int32_t SafetyCheckers_pmRegisterLockMask(uint32_t pllMask, uint32_t *lockMask)
+{
+    uint32_t index;
+    uint32_t lockStat;
+    uint32_t pllLockMask = 0U;
+    int32_t  status = SAFETY_CHECKERS_FAIL;
+
+    for (index = 0U; index < (sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData)); index++)
+    {
+        if ((pllMask & (1U << index)) != 0U)
+        {
+            /* Lock the PLL register access */
+            CSL_REG32_WR((gSafetyCheckers_PmPllData[index].baseAddr + SAFETY_CHECKERS_PM_LOCK_KEY0_OFFSET), SAFETY_CHECKERS_PM_KICK_LOCK);
+            CSL_REG32_WR((gSafetyCheckers_PmPllData[index].baseAddr + SAFETY_CHECKERS_PM_LOCK_KEY1_OFFSET), SAFETY_CHECKERS_PM_KICK_LOCK);
+        }
+
+        /* Confirm the PLL registers are locked */
+        lockStat = (uint32_t)CSL_REG32_RD(gSafetyCheckers_PmPllData[index].baseAddr + SAFETY_CHECKERS_PM_LOCK_KEY0_OFFSET);
+
+        /* check for PLL lock confirmation*/
+        if((lockStat & SAFETY_CHECKERS_PM_LOCK_KEY0_UNLOCKED) == 0x0U)
+        {
+            pllLockMask |= (1U << index);
+        }
+    }
+
+    if((pllLockMask & pllMask) == pllMask)
+    {
+        status = SAFETY_CHECKERS_SOK;
+    }
+
+    if (lockMask != NULL)
+    {
+        *lockMask = pllLockMask;
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_pmGetPllLockStatus(uint32_t *lockMask)
+{
+    uint32_t index;
+    uint32_t lockStat;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (lockMask == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+    else
+    {
+        *lockMask = 0U;
+        for (index = 0U; index < (sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData)); index++)
+        {
+            lockStat = (uint32_t)CSL_REG32_RD(gSafetyCheckers_PmPllData[index].baseAddr + SAFETY_CHECKERS_PM_LOCK_KEY0_OFFSET);
+            if ((lockStat & SAFETY_CHECKERS_PM_LOCK_KEY0_UNLOCKED) == 0x0U)
+            {
+                *lockMask |= (1U << index);
+            }
+        }
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_pmVerifyPllLock(uint32_t *unlockMask)
+{
+    uint32_t lockMask = 0U;
+    uint32_t allMask = SafetyCheckers_pmGetAllPllMask();
+    int32_t  status;
+
+    status = SafetyCheckers_pmGetPllLockStatus(&lockMask);
+    if ((status == SAFETY_CHECKERS_SOK) && (lockMask != allMask))
+    {
+        status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
+    }
+
+    if (unlockMask != NULL)
+    {
+        *unlockMask = allMask & ~lockMask;
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_pmEventInit(SafetyCheckers_PmEventCtx *eventCtx,
+                                   const uintptr_t *pllRegCfg, uint32_t pllSize,
+                                   const uintptr_t *pscRegCfg, uint32_t pscSize)
+{
+    uint32_t index;
+    uint32_t numPll = (uint32_t)(sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData));
+    uint32_t numPsc = (uint32_t)(sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData));
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((eventCtx == NULL) || (pllRegCfg == NULL) || (pscRegCfg == NULL) ||
+        (numPll > 32U) || (numPsc > SAFETY_CHECKERS_PM_EVENT_PSC_MAX))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    for (index = 0U; (status == SAFETY_CHECKERS_SOK) && (index < numPsc); index++)
+    {
+        if ((gSafetyCheckers_PmPscData[index].pdStat > SAFETY_CHECKERS_PM_PSC_SEL_PD_MAX) ||
+            (gSafetyCheckers_PmPscData[index].mdStat > SAFETY_CHECKERS_PM_PSC_SEL_MD_MAX))
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) &&
+        ((SAFETY_CHECKERS_PM_PLL_FLAT_NUM > pllSize) || (SAFETY_CHECKERS_PM_PSC_FLAT_NUM > pscSize)))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        (void)memset(eventCtx, 0, sizeof(SafetyCheckers_PmEventCtx));
+        eventCtx->pllRegCfg    = pllRegCfg;
+        eventCtx->pscRegCfg    = pscRegCfg;
+        eventCtx->pllDirtyMask = SafetyCheckers_pmGetAllPllMask();
+        eventCtx->pscDirtyMask = (1U << numPsc) - 1U;
+
+        for (index = 0U; index < numPll; index++)
+        {
+            if (((uint32_t)CSL_REG32_RD(gSafetyCheckers_PmPllData[index].baseAddr + SAFETY_CHECKERS_PM_PLL_STAT_OFFSET) &
+                 SAFETY_CHECKERS_PM_PLL_STAT_LOCK) != 0U)
+            {
+                eventCtx->pllLockMask |= (1U << index);
+            }
+        }
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_pmEventNotifyPll(SafetyCheckers_PmEventCtx *eventCtx, uint32_t pll)
+{
+    int32_t  status = SAFETY_CHECKERS_FAIL;
+
+    if ((eventCtx != NULL) && (pll < (sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData))))
+    {
+        eventCtx->pllDirtyMask |= (1U << pll);
+        status = SAFETY_CHECKERS_SOK;
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_pmEventNotifyPsc(SafetyCheckers_PmEventCtx *eventCtx, uint32_t psc, uint32_t lpsc)
+{
+    int32_t  status = SAFETY_CHECKERS_FAIL;
+
+    if ((eventCtx != NULL) && (psc < (sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData))))
+    {
+        if (lpsc == SAFETY_CHECKERS_PM_EVENT_LPSC_ALL)
+        {
+            eventCtx->pscDirtyMask |= (1U << psc);
+            status = SAFETY_CHECKERS_SOK;
+        }
+        else if (lpsc < gSafetyCheckers_PmPscData[psc].mdStat)
+        {
+            eventCtx->lpscDirtyMask[psc][lpsc / 32U] |= (1U << (lpsc % 32U));
+            status = SAFETY_CHECKERS_SOK;
+        }
+        else
+        {
+            /* LPSC out of range */
+        }
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_pmEventPoll(SafetyCheckers_PmEventCtx *eventCtx)
+{
+    uint32_t index;
+    uint32_t lockMask = 0U;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (eventCtx == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        for (index = 0U; index < (sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData)); index++)
+        {
+            if (((uint32_t)CSL_REG32_RD(gSafetyCheckers_PmPllData[index].baseAddr + SAFETY_CHECKERS_PM_PLL_STAT_OFFSET) &
+                 SAFETY_CHECKERS_PM_PLL_STAT_LOCK) != 0U)
+            {
+                lockMask |= (1U << index);
+            }
+        }
+
+        /* Lock loss and relock both mark the PLL */
+        eventCtx->pllDirtyMask |= (lockMask ^ eventCtx->pllLockMask);
+        eventCtx->pllLockMask   = lockMask;
+
+        for (index = 0U; index < (sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData)); index++)
+        {
+            if (SafetyCheckers_pmPscBusy(index) != 0U)
+            {
+                eventCtx->pscDirtyMask |= (1U << index);
+            }
+        }
+    }
+
+    return (status);
+}
+
+int32_t SafetyCheckers_pmEventVerify(SafetyCheckers_PmEventCtx *eventCtx, uint32_t sweepCnt)
+{
+    uint32_t index;
+    uint32_t numPll = (uint32_t)(sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData));
+    uint32_t numPsc = (uint32_t)(sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData));
+    SafetyCheckers_RegSetTable table;
+    int32_t  verifyStatus;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((eventCtx == NULL) || (eventCtx->pllRegCfg == NULL) || (eventCtx->pscRegCfg == NULL))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        /* Background sweep, a safety net for the events that were missed */
+        for (index = 0U; index < sweepCnt; index++)
+        {
+            if (eventCtx->sweepIdx < numPll)
+            {
+                eventCtx->pllDirtyMask |= (1U << eventCtx->sweepIdx);
+            }
+            else
+            {
+                eventCtx->pscDirtyMask |= (1U << (eventCtx->sweepIdx - numPll));
+            }
+            eventCtx->sweepIdx = ((eventCtx->sweepIdx + 1U) < (numPll + numPsc)) ? (eventCtx->sweepIdx + 1U) : 0U;
+        }
+    }
+
+    for (index = 0U; (status == SAFETY_CHECKERS_SOK) && (index < numPll); index++)
+    {
+        if ((eventCtx->pllDirtyMask & (1U << index)) != 0U)
+        {
+            SafetyCheckers_pmGetPllModuleTable(index, &table);
+            verifyStatus = SafetyCheckers_regSetVerifyCfg(&table, &eventCtx->pllRegCfg[gSafetyCheckers_PmPllRegIndex[index]],
+                                                          (uint32_t)sizeof(uintptr_t),
+                                                          SAFETY_CHECKERS_PM_PLL_FLAT_NUM - gSafetyCheckers_PmPllRegIndex[index]);
+            if (verifyStatus == SAFETY_CHECKERS_SOK)
+            {
+                eventCtx->pllDirtyMask &= ~(1U << index);
+                eventCtx->pllFailMask  &= ~(1U << index);
+            }
+            else if (verifyStatus == SAFETY_CHECKERS_REG_DATA_MISMATCH)
+            {
+                eventCtx->pllFailMask  |= (1U << index);
+            }
+            else
+            {
+                status = verifyStatus;
+            }
+        }
+    }
+
+    for (index = 0U; (status == SAFETY_CHECKERS_SOK) && (index < numPsc); index++)
+    {
+        status = SafetyCheckers_pmEventVerifyPsc(eventCtx, index);
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && ((eventCtx->pllFailMask | eventCtx->pscFailMask) != 0U))
+    {
+        status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
+    }
+
+    return (status);
+}
+
+/* ========================================================================== */
+/*                       Static Function Definitions                          */
+/* ========================================================================== */
+
+static void SafetyCheckers_pmGetPscRegSetDesc(uint32_t index, SafetyCheckers_RegSetDesc *desc)
+{
+    const SafetyCheckers_PmPscData *pscData = &gSafetyCheckers_PmPscData[index >> 1U];
+
+    /* Even sets are the PD stat registers of a PSC, odd sets its MD stat registers */
+    desc->baseAddr   = pscData->baseAddr;
+    desc->stride     = 0x4U;
+    desc->numOffsets = 1U;
+    desc->mask       = SAFETY_CHECKERS_REGSET_MASK_ALL;
+    desc->module     = index >> 1U;
+    if ((index & 1U) == 0U)
+    {
+        desc->count     = pscData->pdStat;
+        desc->offsetArr = gSafetyCheckers_PmPscPdStatOffset;
+    }
+    else
+    {
+        desc->count     = pscData->mdStat;
+        desc->offsetArr = gSafetyCheckers_PmPscMdStatOffset;
+    }
+}
+
+static void SafetyCheckers_pmGetPllRegSetDesc(uint32_t index, SafetyCheckers_RegSetDesc *desc)
+{
+    const SafetyCheckers_PmPllData *pllData = &gSafetyCheckers_PmPllData[index];
+
+    /* The register count of each PLL comes from the generated flat table index */
+    desc->baseAddr   = pllData->baseAddr;
+    desc->stride     = 0U;
+    desc->count      = 1U;
+    desc->offsetArr  = pllData->regOffsetArr;
+    desc->numOffsets = gSafetyCheckers_PmPllRegIndex[index + 1U] - gSafetyCheckers_PmPllRegIndex[index];
+    desc->mask       = SAFETY_CHECKERS_REGSET_MASK_ALL;
+    desc->module     = index;
+}
+
+static void SafetyCheckers_pmGetPscModuleTable(uint32_t psc, SafetyCheckers_RegSetTable *table)
+{
+    table->descArr   = NULL;
+    table->getDesc   = SafetyCheckers_pmGetPscRegSetDesc;
+    table->firstDesc = 2U * psc;
+    table->numDesc   = 2U;
+}
+
+static void SafetyCheckers_pmGetPllModuleTable(uint32_t pll, SafetyCheckers_RegSetTable *table)
+{
+    table->descArr   = NULL;
+    table->getDesc   = SafetyCheckers_pmGetPllRegSetDesc;
+    table->firstDesc = pll;
+    table->numDesc   = 1U;
+}
+
+static int32_t SafetyCheckers_pmPscSelCount(const SafetyCheckers_PmPscSel *pscSel, uint32_t *regCount)
+{
+    uint32_t index;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    *regCount = 0U;
+    if (pscSel == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    for (index = 0U; (status == SAFETY_CHECKERS_SOK) &&
+                     (index < (sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData))); index++)
+    {
+        status = SafetyCheckers_pmPscSelMaskCount(pscSel[index].pdMask, SAFETY_CHECKERS_PM_PSC_SEL_PD_MAX / 32U,
+                                                  gSafetyCheckers_PmPscData[index].pdStat, regCount);
+        if (status == SAFETY_CHECKERS_SOK)
+        {
+            status = SafetyCheckers_pmPscSelMaskCount(pscSel[index].mdMask, SAFETY_CHECKERS_PM_PSC_SEL_MD_MAX / 32U,
+                                                      gSafetyCheckers_PmPscData[index].mdStat, regCount);
+        }
+    }
+
+    return (status);
+}
+
+static int32_t SafetyCheckers_pmPscSelMaskCount(const uint32_t *mask, uint32_t numWords, uint32_t numReg,
+                                                uint32_t *regCount)
+{
+    uint32_t word;
+    uint32_t bits;
+    uint32_t validMask;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    for (word = 0U; word < numWords; word++)
+    {
+        /* Bits past the PD or MD stat count of the PSC select registers that do not exist */
+        if (numReg >= (32U * (word + 1U)))
+        {
+            validMask = 0xFFFFFFFFU;
+        }
+        else if (numReg > (32U * word))
+        {
+            validMask = (1U << (numReg - (32U * word))) - 1U;
+        }
+        else
+        {
+            validMask = 0U;
+        }
+
+        bits = mask[word];
+        if ((bits & ~validMask) != 0U)
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+
+        while (bits != 0U)
+        {
+            bits &= bits - 1U;
+            *regCount += 1U;
+        }
+    }
+
+    return (status);
+}
+
+static int32_t SafetyCheckers_pmCheckPscPdMap(const SafetyCheckers_PmPscPdMap *pdMap)
+{
+    uint32_t index;
+    uint32_t regNum;
+    uint32_t pd;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (pdMap == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    for (index = 0U; (status == SAFETY_CHECKERS_SOK) &&
+                     (index < (sizeof(gSafetyCheckers_PmPscData) / sizeof(SafetyCheckers_PmPscData))); index++)
+    {
+        if (pdMap[index].lpscPd != NULL)
+        {
+            if (pdMap[index].numLpsc != gSafetyCheckers_PmPscData[index].mdStat)
+            {
+                status = SAFETY_CHECKERS_FAIL;
+            }
+
+            /* Every mapped PD shall be a PD stat register of the same PSC */
+            for (regNum = 0U; (status == SAFETY_CHECKERS_SOK) && (regNum < pdMap[index].numLpsc); regNum++)
+            {
+                pd = (uint32_t)pdMap[index].lpscPd[regNum];
+                if ((pd != SAFETY_CHECKERS_PM_PSC_PD_NONE) &&
+                    ((pd >= gSafetyCheckers_PmPscData[index].pdStat) || (pd >= SAFETY_CHECKERS_PM_PSC_SEL_PD_MAX)))
+                {
+                    status = SAFETY_CHECKERS_FAIL;
+                }
+            }
+        }
+    }
+
+    return (status);
+}
+
+static uint32_t SafetyCheckers_pmPscSelRead(uint32_t regAddr, const uint32_t *mask, uint32_t numWords,
+                                            uintptr_t *regCfg, const uintptr_t *goldenCfg, uint32_t *mismatchCnt)
+{
+    uint32_t word;
+    uint32_t bits;
+    uint32_t statAddr;
+    uint32_t readData;
+    uint32_t offset = 0U;
+
+    for (word = 0U; word < numWords; word++)
+    {
+        /* Unselected words and the bits above the last selected one are never read */
+        bits = mask[word];
+        statAddr = regAddr + (word * 32U * 4U);
+        while (bits != 0U)
+        {
+            if ((bits & 1U) != 0U)
+            {
+                readData = (uint32_t)CSL_REG32_RD(statAddr);
+                if (regCfg != NULL)
+                {
+                    regCfg[offset] = (uintptr_t)readData;
+                }
+                else
+                {
+                    *mismatchCnt |= SafetyCheckers_regCfgCompare(goldenCfg, (uint32_t)sizeof(uintptr_t), offset,
+                                                                 readData, SAFETY_CHECKERS_REGSET_MASK_ALL);
+                }
+                offset++;
+            }
+            bits >>= 1U;
+            statAddr += 4U;
+        }
+    }
+
+    return offset;
+}
+
+static int32_t SafetyCheckers_pmGetPllCfgReg(uint32_t pll, const uintptr_t *pllRegCfg, uint32_t regOffset,
+                                             uint32_t *regVal)
+{
+    uint32_t regNum;
+    int32_t  status = SAFETY_CHECKERS_FAIL;
+
+    /* The registers of a PLL sit in the configuration in the order of its offset array */
+    for (regNum = gSafetyCheckers_PmPllRegIndex[pll];
+         (status != SAFETY_CHECKERS_SOK) && (regNum < gSafetyCheckers_PmPllRegIndex[pll + 1U]); regNum++)
+    {
+        if (gSafetyCheckers_PmPllData[pll].regOffsetArr[regNum - gSafetyCheckers_PmPllRegIndex[pll]] == regOffset)
+        {
+            *regVal = (uint32_t)pllRegCfg[regNum];
+            status  = SAFETY_CHECKERS_SOK;
+        }
+    }
+
+    return (status);
+}
+
+static uint32_t SafetyCheckers_pmGetAllPllMask(void)
+{
+    uint32_t numPll = (uint32_t)(sizeof(gSafetyCheckers_PmPllData) / sizeof(SafetyCheckers_PmPllData));
+
+    /* A lock mask holds up to 32 PLLs */
+    return (numPll >= 32U) ? 0xFFFFFFFFU : ((1U << numPll) - 1U);
+}
+
+static uint32_t SafetyCheckers_pmGetPscCfgOffset(uint32_t psc)
+{
+    uint32_t index;
+    uint32_t offset = 0U;
+
+    /* PD stats then MD stats of every PSC before this one */
+    for (index = 0U; index < psc; index++)
+    {
+        offset += gSafetyCheckers_PmPscData[index].pdStat + gSafetyCheckers_PmPscData[index].mdStat;
+    }
+
+    return offset;
+}
+
+static int32_t SafetyCheckers_pmEventVerifyPsc(SafetyCheckers_PmEventCtx *eventCtx, uint32_t psc)
+{
+    uint32_t lpsc;
+    uint32_t word;
+    uint32_t readData;
+    uint32_t lpscDirty = 0U;
+    uint32_t mismatchCnt = 0U;
+    uint32_t offset = SafetyCheckers_pmGetPscCfgOffset(psc);
+    const SafetyCheckers_PmPscData *pscData = &gSafetyCheckers_PmPscData[psc];
+    SafetyCheckers_RegSetTable table;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    for (word = 0U; word < (SAFETY_CHECKERS_PM_PSC_SEL_MD_MAX / 32U); word++)
+    {
+        lpscDirty |= eventCtx->lpscDirtyMask[psc][word];
+    }
+
+    if (((eventCtx->pscDirtyMask & (1U << psc)) != 0U) || (lpscDirty != 0U))
+    {
+        SafetyCheckers_pmGetPscModuleTable(psc, &table);
+        if ((eventCtx->pscDirtyMask & (1U << psc)) == 0U)
+        {
+            /* Only the PD stat registers, the MD stat registers of the dirty LPSCs follow */
+            table.numDesc = 1U;
+        }
+        status = SafetyCheckers_regSetVerifyCfg(&table, &eventCtx->pscRegCfg[offset], (uint32_t)sizeof(uintptr_t),
+                                                SAFETY_CHECKERS_PM_PSC_FLAT_NUM - offset);
+        if (status == SAFETY_CHECKERS_REG_DATA_MISMATCH)
+        {
+            mismatchCnt++;
+            status = SAFETY_CHECKERS_SOK;
+        }
+
+        if ((status == SAFETY_CHECKERS_SOK) && ((eventCtx->pscDirtyMask & (1U << psc)) == 0U))
+        {
+            for (lpsc = 0U; lpsc < pscData->mdStat; lpsc++)
+            {
+                if ((eventCtx->lpscDirtyMask[psc][lpsc / 32U] & (1U << (lpsc % 32U))) != 0U)
+                {
+                    readData = (uint32_t)CSL_REG32_RD(pscData->baseAddr + SAFETY_CHECKERS_PM_PSC_MD_STAT_OFFSET + (4U * lpsc));
+                    mismatchCnt += SafetyCheckers_regCfgCompare(eventCtx->pscRegCfg, (uint32_t)sizeof(uintptr_t),
+                                                                offset + pscData->pdStat + lpsc, readData,
+                                                                SAFETY_CHECKERS_REGSET_MASK_ALL);
+                }
+            }
+        }
+
+        if ((status == SAFETY_CHECKERS_SOK) && (mismatchCnt == 0U))
+        {
+            eventCtx->pscDirtyMask &= ~(1U << psc);
+            eventCtx->pscFailMask  &= ~(1U << psc);
+            for (word = 0U; word < (SAFETY_CHECKERS_PM_PSC_SEL_MD_MAX / 32U); word++)
+            {
+                eventCtx->lpscDirtyMask[psc][word] = 0U;
+            }
+        }
+        else if (status == SAFETY_CHECKERS_SOK)
+        {
+            eventCtx->pscFailMask  |= (1U << psc);
+        }
+        else
+        {
+            /* Verify failed, the PSC stays dirty */
+        }
+    }
+
+    return (status);
+}
+
+static uint32_t SafetyCheckers_pmPscBusy(uint32_t psc)
+{
+    uint32_t word;
+    uint32_t busy = 0U;
+
+    for (word = 0U; (word * 32U) < gSafetyCheckers_PmPscData[psc].pdStat; word++)
+    {
+        busy |= (uint32_t)CSL_REG32_RD(gSafetyCheckers_PmPscData[psc].baseAddr + SAFETY_CHECKERS_PM_PSC_PTSTAT_OFFSET + (4U * word));
+    }
+
+    return busy;
+}
+
+static uint32_t SafetyCheckers_pmPscRegInFlight(uint32_t psc, uint32_t reg, uint32_t regVal)
+{
+    uint32_t inFlight;
+
+    /* reg is the register of the PSC in golden order, the PD stats then the MD stats */
+    if (reg < gSafetyCheckers_PmPscData[psc].pdStat)
+    {
+        inFlight = ((regVal & SAFETY_CHECKERS_PM_PSC_PD_STAT_STATE_MASK) > SAFETY_CHECKERS_PM_PSC_PD_STAT_STATE_ON) ? 1U : 0U;
+    }
+    else
+    {
+        inFlight = ((regVal & SAFETY_CHECKERS_PM_PSC_MD_STAT_STATE_MASK) > SAFETY_CHECKERS_PM_PSC_MD_STAT_STATE_ENABLE) ? 1U : 0U;
+    }
+
+    if ((inFlight == 0U) && (SafetyCheckers_pmPscBusy(psc) != 0U))
+    {
+        inFlight = 1U;
+    }
+
+    return inFlight;
+}
@@ -78,7 +78,7 @@
 /*                             Include Files                                  */
 /* ========================================================================== */
 
-/* None */
+#include <safety_checkers_common.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -88,7 +88,23 @@ extern "C" {
 /*                           Macros & Typedefs                                */
 /* ========================================================================== */
 
-/* None */
+/** \brief Number of PD stat registers of one PSC that a PSC select bitmap can hold */
+#define SAFETY_CHECKERS_PM_PSC_SEL_PD_MAX                         (64U)
+/** \brief Number of MD stat registers (LPSCs) of one PSC that a PSC select bitmap can hold */
+#define SAFETY_CHECKERS_PM_PSC_SEL_MD_MAX                         (128U)
+/** \brief Number of HSDIV outputs of a PLL that can be decoded */
+#define SAFETY_CHECKERS_PM_PLL_HSDIV_MAX                          (16U)
+/** \brief Output selectors of SafetyCheckers_PmPllFreqRange besides the HSDIV index */
+#define SAFETY_CHECKERS_PM_PLL_OUT_VCO                            (0x100U)
+#define SAFETY_CHECKERS_PM_PLL_OUT_POSTDIV                        (0x101U)
+/** \brief LPSC map entry of an LPSC that does not belong to a switchable PD and is always read */
+#define SAFETY_CHECKERS_PM_PSC_PD_NONE                            (0xFFU)
+/** \brief Number of in-flight PSC registers that a settle verify can re-sample */
+#define SAFETY_CHECKERS_PM_PSC_SETTLE_MAX                         (16U)
+/** \brief Number of PSCs that an event context can track */
+#define SAFETY_CHECKERS_PM_EVENT_PSC_MAX                          (8U)
+/** \brief LPSC of SafetyCheckers_pmEventNotifyPsc that marks every LPSC of the PSC */
+#define SAFETY_CHECKERS_PM_EVENT_LPSC_ALL                         (0xFFFFFFFFU)
 
 /**
  * @ingroup PM_SAFETY_CHECKERS
@@ -132,6 +148,110 @@ typedef struct
     uint32_t mdStat;
 } SafetyCheckers_PmPscData;
 
+/**
+ *
+ * \brief   Structure to select the PD and MD stat registers of one PSC
+ *          (one entry of gSafetyCheckers_PmPscData) for the selective
+ *          PSC verify. Bit n of pdMask selects PD n, bit n of mdMask
+ *          selects LPSC n; bit n of a mask is bit (n % 32) of word (n / 32).
+ *
+ */
+typedef struct
+{
+    /* Bitmap of the selected PD stat registers */
+    uint32_t pdMask[SAFETY_CHECKERS_PM_PSC_SEL_PD_MAX / 32U];
+    /* Bitmap of the selected MD stat registers */
+    uint32_t mdMask[SAFETY_CHECKERS_PM_PSC_SEL_MD_MAX / 32U];
+} SafetyCheckers_PmPscSel;
+
+/**
+ *
+ * \brief   Structure to hold the power domain of every LPSC of one PSC
+ *          (one entry of gSafetyCheckers_PmPscData), taken from the PSC
+ *          data of the SoC TRM. lpscPd[n] is the PD number of LPSC n, or
+ *          SAFETY_CHECKERS_PM_PSC_PD_NONE. A NULL lpscPd reads every LPSC.
+ *
+ */
+typedef struct
+{
+    /* PD number of each LPSC of the PSC */
+    const uint8_t *lpscPd;
+    /* Number of entries of lpscPd, the MD stat count of the PSC */
+    uint32_t numLpsc;
+} SafetyCheckers_PmPscPdMap;
+
+/**
+ *
+ * \brief   Structure to hold the output frequencies of one PLL decoded from
+ *          its registers in a PLL register configuration. An HSDIV output
+ *          that is not part of the configuration or is disabled reads 0.
+ *
+ */
+typedef struct
+{
+    /* VCO frequency in Hz, the reference clock when the PLL is bypassed */
+    uint64_t vcoFreqHz;
+    /* Frequency after POSTDIV1 and POSTDIV2 in Hz */
+    uint64_t postDivFreqHz;
+    /* Frequency of each HSDIV output in Hz */
+    uint64_t hsdivFreqHz[SAFETY_CHECKERS_PM_PLL_HSDIV_MAX];
+    /* 1 when the PLL is locked or bypassed, else 0 */
+    uint32_t locked;
+    /* 1 when the PLL is bypassed, else 0 */
+    uint32_t bypass;
+} SafetyCheckers_PmPllFreq;
+
+/**
+ *
+ * \brief   Structure to hold the expected frequency range of one PLL output
+ *
+ */
+typedef struct
+{
+    /* Index of the PLL (entry of gSafetyCheckers_PmPllData) */
+    uint32_t pll;
+    /* Reference clock frequency of the PLL in Hz */
+    uint32_t refFreqHz;
+    /* HSDIV index, SAFETY_CHECKERS_PM_PLL_OUT_VCO or SAFETY_CHECKERS_PM_PLL_OUT_POSTDIV */
+    uint32_t output;
+    /* Lowest allowed frequency in Hz */
+    uint64_t minFreqHz;
+    /* Highest allowed frequency in Hz */
+    uint64_t maxFreqHz;
+} SafetyCheckers_PmPllFreqRange;
+
+/**
+ *
+ * \brief   Structure to hold the state of the event driven PM verify. PLLs and
+ *          LPSCs are marked dirty by a PLL lock change or a PSC transition and
+ *          only the dirty ones are verified; a background sweep marks a few
+ *          more modules dirty on every verify. Bit n of a PLL mask is PLL n and
+ *          bit n of a PSC mask is PSC n. It shall only be updated through the
+ *          SafetyCheckers_pmEvent APIs.
+ *
+ */
+typedef struct
+{
+    /* Pointer of the golden PLL register configuration */
+    const uintptr_t *pllRegCfg;
+    /* Pointer of the golden PSC register configuration */
+    const uintptr_t *pscRegCfg;
+    /* PLLs to be verified */
+    uint32_t pllDirtyMask;
+    /* PLL lock state seen by the last poll */
+    uint32_t pllLockMask;
+    /* PLLs that mismatched on their last verify */
+    uint32_t pllFailMask;
+    /* PSCs to be verified as a whole */
+    uint32_t pscDirtyMask;
+    /* PSCs that mismatched on their last verify */
+    uint32_t pscFailMask;
+    /* LPSCs to be verified, one bitmap per PSC */
+    uint32_t lpscDirtyMask[SAFETY_CHECKERS_PM_EVENT_PSC_MAX][SAFETY_CHECKERS_PM_PSC_SEL_MD_MAX / 32U];
+    /* Next module of the background sweep, the PLLs then the PSCs */
+    uint32_t sweepIdx;
+} SafetyCheckers_PmEventCtx;
+
 /** @} */
 
 /* ========================================================================== */
@@ -166,6 +286,18 @@ typedef struct
  */
 int32_t SafetyCheckers_pmGetPscRegCfg(uintptr_t *pscRegCfg, uint32_t size);
 
+/**
+ *  \brief    Same as SafetyCheckers_pmGetPscRegCfg with a 32-bit PSC register
+ *            configuration, e.g. the PSC section of a packed golden image.
+ *
+ *  \param    pscRegCfg         [IN/OUT]       Pointer of the 32-bit PSC register configuration
+ *  \param    size              [IN]           Size of register configuration memory
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmGetPscRegCfg32(uint32_t *pscRegCfg, uint32_t size);
+
 /**
  *  \brief    API to read back and compares the current register configuration for PSC module.
  *            E.g. When the PSC register verify is requested, SafetyCheckers_pmVerifyPscRegCfg
@@ -180,6 +312,18 @@ int32_t SafetyCheckers_pmGetPscRegCfg(uintptr_t *pscRegCfg, uint32_t size);
  */
 int32_t SafetyCheckers_pmVerifyPscRegCfg(const uintptr_t *pscRegCfg, uint32_t size);
 
+/**
+ *  \brief    Same as SafetyCheckers_pmVerifyPscRegCfg with a 32-bit PSC register
+ *            configuration, e.g. the PSC section of a packed golden image.
+ *
+ *  \param    pscRegCfg         [IN]           Pointer of the 32-bit PSC register configuration
+ *  \param    size              [IN]           Size of register configuration memory
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmVerifyPscRegCfg32(const uint32_t *pscRegCfg, uint32_t size);
+
 /**
  *  \brief    API to get register configuration for PLL module.
  *            E.g. When the PLL register config is requested, SafetyCheckers_pmGetPllRegCfg
@@ -195,6 +339,18 @@ int32_t SafetyCheckers_pmVerifyPscRegCfg(const uintptr_t *pscRegCfg, uint32_t si
  */
 int32_t SafetyCheckers_pmGetPllRegCfg(uintptr_t *pllRegCfg, uint32_t size);
 
+/**
+ *  \brief    Same as SafetyCheckers_pmGetPllRegCfg with a 32-bit PLL register
+ *            configuration, e.g. the PLL section of a packed golden image.
+ *
+ *  \param    pllRegCfg         [IN/OUT]       Pointer of the 32-bit PLL register configuration
+ *  \param    size              [IN]           Size of register configuration memory
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmGetPllRegCfg32(uint32_t *pllRegCfg, uint32_t size);
+
 /**
  *  \brief    API to read back and compares the current register configuration for PLL module.
  *            E.g. When the PLL register verify is requested, SafetyCheckers_pmVerifyPllRegCfg
@@ -209,6 +365,376 @@ int32_t SafetyCheckers_pmGetPllRegCfg(uintptr_t *pllRegCfg, uint32_t size);
  */
 int32_t SafetyCheckers_pmVerifyPllRegCfg(const uintptr_t *pllRegCfg, uint32_t size);
 
+/**
+ *  \brief    Same as SafetyCheckers_pmVerifyPllRegCfg with a 32-bit PLL register
+ *            configuration, e.g. the PLL section of a packed golden image.
+ *
+ *  \param    pllRegCfg         [IN]           Pointer of the 32-bit PLL register configuration
+ *  \param    size              [IN]           Size of register configuration memory
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmVerifyPllRegCfg32(const uint32_t *pllRegCfg, uint32_t size);
+
+/**
+ *  \brief    Same as SafetyCheckers_pmVerifyPscRegCfg as a straight-line sequence of
+ *            register reads, generated per SoC by utils/safety_checkers_verify_gen.py
+ *            into src/soc/<soc>/safety_checkers_verify_soc.c.
+ *
+ *  \param    pscRegCfg         [IN]           Pointer of the PSC golden register configuration
+ *  \param    size              [IN]           Size of golden configuration memory
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmVerifyPscRegCfgUnrolled(const uintptr_t *pscRegCfg, uint32_t size);
+
+/**
+ *  \brief    Same as SafetyCheckers_pmVerifyPllRegCfg as a straight-line sequence of
+ *            register reads, generated per SoC by utils/safety_checkers_verify_gen.py
+ *            into src/soc/<soc>/safety_checkers_verify_soc.c.
+ *
+ *  \param    pllRegCfg         [IN]           Pointer of the PLL golden register configuration
+ *  \param    size              [IN]           Size of golden configuration memory
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmVerifyPllRegCfgUnrolled(const uintptr_t *pllRegCfg, uint32_t size);
+
+/**
+ *  \brief    API to verify the PSC register configuration like
+ *            SafetyCheckers_pmVerifyPscRegCfg, without reporting registers that
+ *            are sampled during a legitimate power transition. A mismatching
+ *            register is in flight when its PD or MD state is a transition state
+ *            or a PD of its PSC has a transition in progress in PTSTAT. Only the
+ *            in-flight registers are re-sampled, each time once PTSTAT of their
+ *            PSCs is clear, for at most maxWaitUsec micro seconds. A register
+ *            that still mismatches once settled, or is still in flight when the
+ *            wait runs out, is reported. More than SAFETY_CHECKERS_PM_PSC_SETTLE_MAX
+ *            in-flight registers are reported as mismatches.
+ *
+ *  \param    pscRegCfg         [IN]           Pointer of the golden PSC register configuration
+ *  \param    size              [IN]           Size of golden configuration memory
+ *  \param    getTimeUsec       [IN]           Time stamp function bounding the wait
+ *  \param    maxWaitUsec       [IN]           Maximum time in micro seconds to wait for in-flight
+ *                                             registers to settle, 0 reports them at once
+ *  \param    resampleCnt       [OUT]          Number of in-flight registers re-sampled, can be NULL
+ *
+ *  \return   SAFETY_CHECKERS_SOK when no register mismatches persistently,
+ *            SAFETY_CHECKERS_REG_DATA_MISMATCH when one does, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmVerifyPscRegCfgSettle(const uintptr_t *pscRegCfg, uint32_t size,
+                                               SafetyCheckers_GetTimeUsecFxn getTimeUsec, uint64_t maxWaitUsec,
+                                               uint32_t *resampleCnt);
+
+/**
+ *  \brief    API to get the number of registers selected by a PSC selection, i.e. the
+ *            size of the compact golden used with SafetyCheckers_pmGetPscSelRegCfg and
+ *            SafetyCheckers_pmVerifyPscSelRegCfg.
+ *
+ *  \param    pscSel            [IN]           Array of SafetyCheckers_pmGetNumPsc selections,
+ *                                              one per entry of gSafetyCheckers_PmPscData
+ *
+ *  \return   Number of selected registers, 0 when the selection is NULL or selects
+ *            a PD or LPSC the PSC does not have.
+ *
+ */
+uint32_t SafetyCheckers_pmGetPscSelRegCount(const SafetyCheckers_PmPscSel *pscSel);
+
+/**
+ *  \brief    API to get the selected PD and MD stat registers of every PSC. The
+ *            registers are stored PSC by PSC, the selected PD stat registers in
+ *            ascending order followed by the selected MD stat registers.
+ *
+ *  \param    pscSel            [IN]           Array of SafetyCheckers_pmGetNumPsc selections
+ *  \param    pscRegCfg         [IN/OUT]       Pointer to store the compact PSC register configuration
+ *  \param    size              [IN]           Size of register configuration memory
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmGetPscSelRegCfg(const SafetyCheckers_PmPscSel *pscSel, uintptr_t *pscRegCfg,
+                                         uint32_t size);
+
+/**
+ *  \brief    API to verify the selected PD and MD stat registers of every PSC against
+ *            a compact golden taken with SafetyCheckers_pmGetPscSelRegCfg and the
+ *            same selection. Registers that are not selected are not read.
+ *
+ *  \param    pscSel            [IN]           Array of SafetyCheckers_pmGetNumPsc selections
+ *  \param    pscRegCfg         [IN]           Pointer of the compact PSC golden register configuration
+ *  \param    size              [IN]           Size of golden configuration memory
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmVerifyPscSelRegCfg(const SafetyCheckers_PmPscSel *pscSel, const uintptr_t *pscRegCfg,
+                                            uint32_t size);
+
+/**
+ *  \brief    Same as SafetyCheckers_pmVerifyPscRegCfg, but power state aware. The PD stat
+ *            registers of a PSC are read and verified first; the MD stat registers of the
+ *            LPSCs whose PD is powered off are then neither read nor compared. A PD that
+ *            went off since the golden was taken fails the PD stat compare, so the
+ *            skipped LPSCs are still covered by the PD state.
+ *
+ *  \param    pscRegCfg         [IN]           Pointer of the PSC golden register configuration
+ *  \param    size              [IN]           Size of golden configuration memory
+ *  \param    pdMap             [IN]           Array of SafetyCheckers_pmGetNumPsc LPSC to PD maps
+ *  \param    skipCnt           [OUT]          Number of MD stat registers skipped, can be NULL
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmVerifyPscRegCfgPdAware(const uintptr_t *pscRegCfg, uint32_t size,
+                                                const SafetyCheckers_PmPscPdMap *pdMap, uint32_t *skipCnt);
+
+/**
+ *  \brief    API to decode the output frequencies of one PLL from a PLL register
+ *            configuration taken with SafetyCheckers_pmGetPllRegCfg, without any
+ *            register read or TISCI request.
+ *            fvco = fref * (FB_DIV_INT + FB_DIV_FRAC / 2^24) / REF_DIV,
+ *            fpostdiv = fvco / (POST_DIV1 * POST_DIV2), fhsdiv = fvco / (HSDIV + 1).
+ *
+ *  \param    pll               [IN]           Index of the PLL (entry of gSafetyCheckers_PmPllData)
+ *  \param    pllRegCfg         [IN]           Pointer of the PLL register configuration
+ *  \param    size              [IN]           Size of register configuration memory
+ *  \param    refFreqHz         [IN]           Reference clock frequency of the PLL in Hz
+ *  \param    pllFreq           [OUT]          Decoded PLL output frequencies
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, SAFETY_CHECKERS_FAIL when the
+ *            PLL is not a PLL_16FFT or its dividers are zero, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmDecodePllFreq(uint32_t pll, const uintptr_t *pllRegCfg, uint32_t size,
+                                       uint32_t refFreqHz, SafetyCheckers_PmPllFreq *pllFreq);
+
+/**
+ *  \brief    API to check PLL output frequencies decoded from a PLL register
+ *            configuration against expected ranges. An output of an unlocked PLL
+ *            is out of range.
+ *
+ *  \param    pllRegCfg         [IN]           Pointer of the PLL register configuration
+ *  \param    size              [IN]           Size of register configuration memory
+ *  \param    freqRange         [IN]           Array of expected output frequency ranges
+ *  \param    numRange          [IN]           Number of entries of freqRange
+ *
+ *  \return   SAFETY_CHECKERS_SOK when every output is in range,
+ *            SAFETY_CHECKERS_REG_DATA_MISMATCH when one is not, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmVerifyPllFreq(const uintptr_t *pllRegCfg, uint32_t size,
+                                       const SafetyCheckers_PmPllFreqRange *freqRange, uint32_t numRange);
+
+/**
+ *  \brief    API to re-capture the registers of one PLL into an existing PLL register
+ *            configuration taken with SafetyCheckers_pmGetPllRegCfg, e.g. after an
+ *            authorised clock change. The other PLLs of the configuration are kept.
+ *
+ *  \param    pll               [IN]           Index of the PLL (entry of gSafetyCheckers_PmPllData)
+ *  \param    pllRegCfg         [IN/OUT]       Pointer of the PLL golden register configuration
+ *  \param    size              [IN]           Size of golden configuration memory
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmUpdatePllRegCfg(uint32_t pll, uintptr_t *pllRegCfg, uint32_t size);
+
+/**
+ *  \brief    API to re-capture the MD stat register of one LPSC and the PD stat
+ *            register of the power domain owning it into an existing PSC register
+ *            configuration taken with SafetyCheckers_pmGetPscRegCfg, e.g. after an
+ *            authorised device state change. The PD stat register is included as a
+ *            module state change can power its domain up or down. The other PD
+ *            stat registers of the PSC are kept, so a change of another domain is
+ *            still reported. Only the MD stat register is re-captured for an LPSC
+ *            that pdMap does not map to a PD.
+ *
+ *  \param    psc               [IN]           Index of the PSC (entry of gSafetyCheckers_PmPscData)
+ *  \param    lpsc              [IN]           LPSC (MD stat register) number within the PSC
+ *  \param    pdMap             [IN]           Array of SafetyCheckers_pmGetNumPsc LPSC to PD maps
+ *  \param    pscRegCfg         [IN/OUT]       Pointer of the PSC golden register configuration
+ *  \param    size              [IN]           Size of golden configuration memory
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmUpdatePscRegCfg(uint32_t psc, uint32_t lpsc, const SafetyCheckers_PmPscPdMap *pdMap,
+                                         uintptr_t *pscRegCfg, uint32_t size);
+
+/**
+ *  \brief    API to get the number of PSC domains (entries of gSafetyCheckers_PmPscData)
+ *
+ *  \return   Number of PSC domains
+ *
+ */
+uint32_t SafetyCheckers_pmGetNumPsc(void);
+
+/**
+ *  \brief    API to get the number of PLLs (entries of gSafetyCheckers_PmPllData)
+ *
+ *  \return   Number of PLLs
+ *
+ */
+uint32_t SafetyCheckers_pmGetNumPll(void);
+
+/**
+ *  \brief    API to get the number of registers read for one PSC domain
+ *
+ *  \param    psc               [IN]           Index of the PSC domain
+ *
+ *  \return   Number of registers of the PSC domain, 0 for an invalid index
+ *
+ */
+uint32_t SafetyCheckers_pmGetPscModuleRegCount(uint32_t psc);
+
+/**
+ *  \brief    API to get the 32-bit register configuration of one PSC domain.
+ *            The registers are stored in PD stat registers followed by the MD stat registers.
+ *
+ *  \param    psc               [IN]           Index of the PSC domain
+ *  \param    regCfg            [IN/OUT]       Pointer to store the register configuration
+ *  \param    size              [IN]           Size of register configuration memory
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmGetPscModuleRegCfg32(uint32_t psc, uint32_t *regCfg, uint32_t size);
+
+/**
+ *  \brief    API to read back one PSC domain and compare it against its 32-bit
+ *            golden register configuration.
+ *
+ *  \param    psc               [IN]           Index of the PSC domain
+ *  \param    regCfg            [IN]           Pointer of the golden register configuration
+ *  \param    size              [IN]           Size of golden configuration memory
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmVerifyPscModuleRegCfg32(uint32_t psc, const uint32_t *regCfg, uint32_t size);
+
+/**
+ *  \brief    API to get the number of registers read for one PLL
+ *
+ *  \param    pll               [IN]           Index of the PLL
+ *
+ *  \return   Number of registers of the PLL, 0 for an invalid index
+ *
+ */
+uint32_t SafetyCheckers_pmGetPllModuleRegCount(uint32_t pll);
+
+/**
+ *  \brief    API to get the 32-bit register configuration of one PLL.
+ *            The registers are stored in the order of the PLL register offset list.
+ *
+ *  \param    pll               [IN]           Index of the PLL
+ *  \param    regCfg            [IN/OUT]       Pointer to store the register configuration
+ *  \param    size              [IN]           Size of register configuration memory
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmGetPllModuleRegCfg32(uint32_t pll, uint32_t *regCfg, uint32_t size);
+
+/**
+ *  \brief    API to read back one PLL and compare it against its 32-bit
+ *            golden register configuration.
+ *
+ *  \param    pll               [IN]           Index of the PLL
+ *  \param    regCfg            [IN]           Pointer of the golden register configuration
+ *  \param    size              [IN]           Size of golden configuration memory
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmVerifyPllModuleRegCfg32(uint32_t pll, const uint32_t *regCfg, uint32_t size);
+
+/**
+ *  \brief    API to get the signature of the PSC and PLL register tables (base
+ *            addresses, register counts and offsets). A golden sample is only
+ *            valid for the tables it was taken with.
+ *
+ *  \return   Signature of gSafetyCheckers_PmPscData and gSafetyCheckers_PmPllData
+ *
+ */
+uint64_t SafetyCheckers_pmGetTableSig(void);
+
+/**
+ *  \brief    API to get the register signature tree for PSC module.
+ *            E.g. When the PSC register signature tree is requested,
+ *            SafetyCheckers_pmGetPscRegSigTree reads the same registers as
+ *            SafetyCheckers_pmGetPscRegCfg and builds a tree of signatures over equal ranges
+ *            of them. The tree needs SAFETY_CHECKERS_SIG_TREE_SIZE entries.
+ *
+ *  \param    pscSigTree         [IN/OUT]       Pointer to store the PSC signature tree
+ *  \param    size              [IN]           Number of entries in pscSigTree
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmGetPscRegSigTree(uint64_t *pscSigTree, uint32_t size);
+
+/**
+ *  \brief    API to read back the PSC registers and compare their signature tree
+ *            against the golden signature tree.
+ *            E.g. When the PSC register signature tree verify is requested,
+ *            SafetyCheckers_pmVerifyPscRegSigTree rebuilds the tree in pscSigTreeWork.
+ *            Only the roots are compared when the configuration matches. On a
+ *            mismatch the first register of the smallest mismatching range is
+ *            reported in mismatch. The range is one leaf of the tree and
+ *            mismatch->regCount gives the number of registers it covers.
+ *
+ *  \param    pscSigTree         [IN]           Pointer of the golden PSC signature tree
+ *  \param    pscSigTreeWork     [IN/OUT]       Scratch memory for the current signature tree
+ *  \param    size              [IN]           Number of entries in pscSigTree and pscSigTreeWork
+ *  \param    mismatch          [OUT]          Location of the mismatch, can be NULL
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmVerifyPscRegSigTree(const uint64_t *pscSigTree, uint64_t *pscSigTreeWork,
+                                           uint32_t size, SafetyCheckers_SigMismatch *mismatch);
+
+/**
+ *  \brief    API to get the register signature tree for PLL module.
+ *            E.g. When the PLL register signature tree is requested,
+ *            SafetyCheckers_pmGetPllRegSigTree reads the same registers as
+ *            SafetyCheckers_pmGetPllRegCfg and builds a tree of signatures over equal ranges
+ *            of them. The tree needs SAFETY_CHECKERS_SIG_TREE_SIZE entries.
+ *
+ *  \param    pllSigTree         [IN/OUT]       Pointer to store the PLL signature tree
+ *  \param    size              [IN]           Number of entries in pllSigTree
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmGetPllRegSigTree(uint64_t *pllSigTree, uint32_t size);
+
+/**
+ *  \brief    API to read back the PLL registers and compare their signature tree
+ *            against the golden signature tree.
+ *            E.g. When the PLL register signature tree verify is requested,
+ *            SafetyCheckers_pmVerifyPllRegSigTree rebuilds the tree in pllSigTreeWork.
+ *            Only the roots are compared when the configuration matches. On a
+ *            mismatch the first register of the smallest mismatching range is
+ *            reported in mismatch. The range is one leaf of the tree and
+ *            mismatch->regCount gives the number of registers it covers.
+ *
+ *  \param    pllSigTree         [IN]           Pointer of the golden PLL signature tree
+ *  \param    pllSigTreeWork     [IN/OUT]       Scratch memory for the current signature tree
+ *  \param    size              [IN]           Number of entries in pllSigTree and pllSigTreeWork
+ *  \param    mismatch          [OUT]          Location of the mismatch, can be NULL
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmVerifyPllRegSigTree(const uint64_t *pllSigTree, uint64_t *pllSigTreeWork,
+                                           uint32_t size, SafetyCheckers_SigMismatch *mismatch);
+
 /**
  *  \brief    API to lock the PLL control module registers.
  *            E.g. When the PLL register lock is requested, SafetyCheckers_pmRegisterLock API 
@@ -220,6 +746,117 @@ int32_t SafetyCheckers_pmVerifyPllRegCfg(const uintptr_t *pllRegCfg, uint32_t si
  */
 int32_t SafetyCheckers_pmRegisterLock(void);
 
+/**
+ *  \brief    API to lock the control module registers of the selected PLLs and to
+ *            get the lock state of every PLL in the same pass, so only the PLLs
+ *            found unlocked by SafetyCheckers_pmGetPllLockStatus need to be relocked.
+ *            Bit n of a mask is PLL n (entry n of gSafetyCheckers_PmPllData).
+ *
+ *  \param    pllMask           [IN]           Mask of the PLLs to lock
+ *  \param    lockMask          [OUT]          Mask of the PLLs that are locked, can be NULL
+ *
+ *  \return   SAFETY_CHECKERS_SOK when every selected PLL is locked, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmRegisterLockMask(uint32_t pllMask, uint32_t *lockMask);
+
+/**
+ *  \brief    API to get the lock state of every PLL in one pass. Only the LOCKKEY0
+ *            status is read, nothing is written.
+ *            Bit n of lockMask is set when PLL n (entry n of gSafetyCheckers_PmPllData)
+ *            is locked.
+ *
+ *  \param    lockMask          [OUT]          Mask of the PLLs that are locked
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmGetPllLockStatus(uint32_t *lockMask);
+
+/**
+ *  \brief    API to verify that every PLL is locked without writing the KICK
+ *            registers, e.g. for a high rate lock state poll.
+ *
+ *  \param    unlockMask        [OUT]          Mask of the PLLs that are unlocked, can be NULL
+ *
+ *  \return   SAFETY_CHECKERS_SOK when every PLL is locked,
+ *            SAFETY_CHECKERS_REG_DATA_MISMATCH when one is not.
+ *
+ */
+int32_t SafetyCheckers_pmVerifyPllLock(uint32_t *unlockMask);
+
+/**
+ *  \brief    API to start the event driven PM verify. Every PLL and PSC is marked
+ *            dirty so the first SafetyCheckers_pmEventVerify checks them all.
+ *
+ *  \param    eventCtx          [OUT]          Pointer of the event context
+ *  \param    pllRegCfg         [IN]           Pointer of the golden PLL register configuration
+ *  \param    pllSize           [IN]           Size of golden PLL configuration memory
+ *  \param    pscRegCfg         [IN]           Pointer of the golden PSC register configuration
+ *  \param    pscSize           [IN]           Size of golden PSC configuration memory
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmEventInit(SafetyCheckers_PmEventCtx *eventCtx,
+                                   const uintptr_t *pllRegCfg, uint32_t pllSize,
+                                   const uintptr_t *pscRegCfg, uint32_t pscSize);
+
+/**
+ *  \brief    API to mark one PLL dirty, e.g. from the PLL lock loss interrupt
+ *            handler of the application.
+ *
+ *  \param    eventCtx          [IN/OUT]       Pointer of the event context
+ *  \param    pll               [IN]           Index of the PLL (entry of gSafetyCheckers_PmPllData)
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmEventNotifyPll(SafetyCheckers_PmEventCtx *eventCtx, uint32_t pll);
+
+/**
+ *  \brief    API to mark one LPSC, or every LPSC of a PSC, dirty, e.g. from the
+ *            PSC transition interrupt handler of the application.
+ *
+ *  \param    eventCtx          [IN/OUT]       Pointer of the event context
+ *  \param    psc               [IN]           Index of the PSC (entry of gSafetyCheckers_PmPscData)
+ *  \param    lpsc              [IN]           LPSC of the PSC or SAFETY_CHECKERS_PM_EVENT_LPSC_ALL
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmEventNotifyPsc(SafetyCheckers_PmEventCtx *eventCtx, uint32_t psc, uint32_t lpsc);
+
+/**
+ *  \brief    API to poll the PLL and PSC status bits and mark the affected
+ *            modules dirty. A PLL whose STAT lock bit changed since the last poll
+ *            and a PSC with a PD transition in progress in PTSTAT are marked.
+ *            This reads one register per PLL and one per 32 PDs of each PSC.
+ *
+ *  \param    eventCtx          [IN/OUT]       Pointer of the event context
+ *
+ *  \return   SAFETY_CHECKERS_SOK in case of success, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmEventPoll(SafetyCheckers_PmEventCtx *eventCtx);
+
+/**
+ *  \brief    API to verify the dirty PLLs and LPSCs against the golden register
+ *            configuration. sweepCnt more modules of the background sweep are
+ *            marked dirty first, so every module is verified at least once every
+ *            (number of PLLs + number of PSCs) / sweepCnt calls. A module that
+ *            matches is cleared, one that mismatches stays dirty and is reported
+ *            in pllFailMask / pscFailMask of the context.
+ *
+ *  \param    eventCtx          [IN/OUT]       Pointer of the event context
+ *  \param    sweepCnt          [IN]           Number of modules of the background sweep
+ *
+ *  \return   SAFETY_CHECKERS_SOK when no module mismatches,
+ *            SAFETY_CHECKERS_REG_DATA_MISMATCH when one does, else failure.
+ *
+ */
+int32_t SafetyCheckers_pmEventVerify(SafetyCheckers_PmEventCtx *eventCtx, uint32_t sweepCnt);
+
 /* ========================================================================== */
 /*                       Static Function Definitions                          */
 /* ========================================================================== */
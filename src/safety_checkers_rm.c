@@ -64,13 +64,22 @@
 /*                          Function Declarations                             */
 /* ========================================================================== */
 
-/* None */
+static void SafetyCheckers_rmGetRegSetDesc(uint32_t index, SafetyCheckers_RegSetDesc *desc);
+static void SafetyCheckers_rmGetModuleTable(uint32_t module, SafetyCheckers_RegSetTable *table);
+static void SafetyCheckers_rmVerifyRewind(SafetyCheckers_RmVerifyCursor *cursor);
 
 /* ========================================================================== */
 /*                            Global Variables                                */
 /* ========================================================================== */
 
-/* None */
+/* Register set table of every RM module, the RM golden register configuration layout */
+static const SafetyCheckers_RegSetTable gSafetyCheckers_RmRegSetTable =
+{
+    NULL,
+    SafetyCheckers_rmGetRegSetDesc,
+    0U,
+    (uint32_t)(sizeof(gSafetyCheckers_RmRegData) / sizeof(SafetyCheckers_RmRegData))
+};
 
 /* ========================================================================== */
 /*                          Function Definitions                              */
@@ -81,103 +90,409 @@
  */
 int32_t SafetyCheckers_rmGetRegCfg(uintptr_t *rmRegCfg, uint32_t size)
 {
-    uint32_t offset = 0U;
-    uint32_t totalLength = 0U;
+    return SafetyCheckers_regSetGetCfg(&gSafetyCheckers_RmRegSetTable, rmRegCfg, (uint32_t)sizeof(uintptr_t), size);
+}
+
+int32_t SafetyCheckers_rmGetRegCfg32(uint32_t *rmRegCfg, uint32_t size)
+{
+    return SafetyCheckers_regSetGetCfg(&gSafetyCheckers_RmRegSetTable, rmRegCfg, (uint32_t)sizeof(uint32_t), size);
+}
+
+/**
+ * Design: SAFETY_CHECKERS-245, SAFETY_CHECKERS-251
+ */
+int32_t SafetyCheckers_rmVerifyRegCfg(const uintptr_t *rmRegCfg, uint32_t size)
+{
+    return SafetyCheckers_regSetVerifyCfg(&gSafetyCheckers_RmRegSetTable, rmRegCfg, (uint32_t)sizeof(uintptr_t), size);
+}
+
+int32_t SafetyCheckers_rmVerifyRegCfg32(const uint32_t *rmRegCfg, uint32_t size)
+{
+    return SafetyCheckers_regSetVerifyCfg(&gSafetyCheckers_RmRegSetTable, rmRegCfg, (uint32_t)sizeof(uint32_t), size);
+}
+
+uint32_t SafetyCheckers_rmGetNumModules(void)
+{
+    return (uint32_t)(sizeof(gSafetyCheckers_RmRegData) / sizeof(SafetyCheckers_RmRegData));
+}
+
+uint32_t SafetyCheckers_rmGetModuleRegCount(uint32_t module)
+{
+    uint32_t regCount = 0U;
+    SafetyCheckers_RegSetTable table;
+
+    if (module < (sizeof(gSafetyCheckers_RmRegData) / sizeof(SafetyCheckers_RmRegData)))
+    {
+        SafetyCheckers_rmGetModuleTable(module, &table);
+        regCount = SafetyCheckers_regSetGetCount(&table);
+    }
+
+    return regCount;
+}
+
+int32_t SafetyCheckers_rmGetModuleRegCfg32(uint32_t module, uint32_t *regCfg, uint32_t size)
+{
+    SafetyCheckers_RegSetTable table;
+    int32_t  status = SAFETY_CHECKERS_FAIL;
+
+    if (module < (sizeof(gSafetyCheckers_RmRegData) / sizeof(SafetyCheckers_RmRegData)))
+    {
+        SafetyCheckers_rmGetModuleTable(module, &table);
+        status = SafetyCheckers_regSetGetCfg(&table, regCfg, (uint32_t)sizeof(uint32_t), size);
+    }
+
+    return status;
+}
+
+int32_t SafetyCheckers_rmVerifyModuleRegCfg32(uint32_t module, const uint32_t *regCfg, uint32_t size)
+{
+    SafetyCheckers_RegSetTable table;
+    int32_t  status = SAFETY_CHECKERS_FAIL;
+
+    if (module < (sizeof(gSafetyCheckers_RmRegData) / sizeof(SafetyCheckers_RmRegData)))
+    {
+        SafetyCheckers_rmGetModuleTable(module, &table);
+        status = SafetyCheckers_regSetVerifyCfg(&table, regCfg, (uint32_t)sizeof(uint32_t), size);
+    }
+
+    return status;
+}
+
+uint64_t SafetyCheckers_rmGetTableSig(void)
+{
     uint32_t totalModule;
     uint32_t regNum;
-    uint32_t regArrayLen;
-	int32_t status = SAFETY_CHECKERS_SOK;
-	
-	if (rmRegCfg == NULL)
-	{
-		status = SAFETY_CHECKERS_FAIL;
-	}
+    uint64_t sig = SAFETY_CHECKERS_SIG_SEED;
+    const SafetyCheckers_RmRegData *regData;
 
-    if (status == SAFETY_CHECKERS_SOK)
-	{
-		for (totalModule = 0U; totalModule < (sizeof(gSafetyCheckers_RmRegData) / sizeof(SafetyCheckers_RmRegData)); totalModule++)
-		{
-			totalLength += (uint32_t)((gSafetyCheckers_RmRegData[totalModule].regNum) * (gSafetyCheckers_RmRegData[totalModule].regArrayLen));
-		}
-		
-		if (totalLength > size)
-		{
-			status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
-		}
-	}
+    for (totalModule = 0U; totalModule < (sizeof(gSafetyCheckers_RmRegData) / sizeof(SafetyCheckers_RmRegData)); totalModule++)
+    {
+        regData = &gSafetyCheckers_RmRegData[totalModule];
+        sig = SafetyCheckers_sigUpdate(sig, regData->baseAddr);
+        sig = SafetyCheckers_sigUpdate(sig, regData->regNum);
+        sig = SafetyCheckers_sigUpdate(sig, regData->regArrayLen);
+        sig = SafetyCheckers_sigUpdate(sig, regData->regStartOffset);
+        for (regNum = 0U; regNum < regData->regNum; regNum++)
+        {
+            sig = SafetyCheckers_sigUpdate(sig, regData->regOffsetArr[regNum]);
+        }
+    }
+
+    return sig;
+}
+
+int32_t SafetyCheckers_rmGetRegSig(uint64_t *rmRegSig, uint32_t size)
+{
+    uint32_t totalModule;
+    SafetyCheckers_RegSetTable table;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (rmRegSig == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (SAFETY_CHECKERS_RM_REGSIG_SIZE > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
 
     if (status == SAFETY_CHECKERS_SOK)
-	{
-		for (totalModule = 0U; totalModule < (sizeof(gSafetyCheckers_RmRegData) / sizeof(SafetyCheckers_RmRegData)); totalModule++)
-		{
-			for (regNum = 0U; regNum < gSafetyCheckers_RmRegData[totalModule].regNum; regNum++)
-			{
-				for (regArrayLen = 0U; regArrayLen < gSafetyCheckers_RmRegData[totalModule].regArrayLen; regArrayLen++)
-				{
-					rmRegCfg[offset] = (uintptr_t)CSL_REG32_RD(gSafetyCheckers_RmRegData[totalModule].baseAddr +\
-					((gSafetyCheckers_RmRegData[totalModule].regStartOffset * regArrayLen) + gSafetyCheckers_RmRegData[totalModule].regOffsetArr[regNum]));
-
-					offset++;
-				}
-			}
-		}
-	}
-	
+    {
+        for (totalModule = 0U; totalModule < SAFETY_CHECKERS_RM_REGSIG_SIZE; totalModule++)
+        {
+            SafetyCheckers_rmGetModuleTable(totalModule, &table);
+            rmRegSig[totalModule] = SafetyCheckers_regSetGetSig(&table);
+        }
+    }
+
     return status;
 }
 
-/**
- * Design: SAFETY_CHECKERS-245, SAFETY_CHECKERS-251
- */
-int32_t SafetyCheckers_rmVerifyRegCfg (const uintptr_t *rmRegCfg, uint32_t size)
+int32_t SafetyCheckers_rmVerifyRegSig(const uint64_t *rmRegSig, uint32_t size)
 {
-    uint32_t offset = 0U;
-    uint32_t mismatchCnt = 0U;
-    uint32_t totalLength = 0U;
     uint32_t totalModule;
-    uint32_t regNum;
-    uint32_t regArrayLen;
-	int32_t status = SAFETY_CHECKERS_SOK;
-	
-	if (rmRegCfg == NULL)
-	{
-		status = SAFETY_CHECKERS_FAIL;
-	}
+    uint64_t mismatchCnt = 0U;
+    SafetyCheckers_RegSetTable table;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (rmRegSig == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (SAFETY_CHECKERS_RM_REGSIG_SIZE > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
 
     if (status == SAFETY_CHECKERS_SOK)
-	{
-		for (totalModule = 0U; totalModule < (sizeof(gSafetyCheckers_RmRegData) / sizeof(SafetyCheckers_RmRegData)); totalModule++)
-		{
-			totalLength += (uint32_t)((gSafetyCheckers_RmRegData[totalModule].regNum) * (gSafetyCheckers_RmRegData[totalModule].regArrayLen));
-		}
-
-		if (totalLength > size)
-		{
-			status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
-		}
-	}
+    {
+        for (totalModule = 0U; totalModule < SAFETY_CHECKERS_RM_REGSIG_SIZE; totalModule++)
+        {
+            SafetyCheckers_rmGetModuleTable(totalModule, &table);
+            mismatchCnt |= rmRegSig[totalModule] ^ SafetyCheckers_regSetGetSig(&table);
+        }
+
+        if (mismatchCnt != 0U)
+        {
+            status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
+        }
+    }
+
+    return status;
+}
+
+int32_t SafetyCheckers_rmGetRegSigTree(uint64_t *rmSigTree, uint32_t size)
+{
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (rmSigTree == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (SAFETY_CHECKERS_SIG_TREE_SIZE > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
 
     if (status == SAFETY_CHECKERS_SOK)
-	{
-		for (totalModule = 0U; totalModule < (sizeof(gSafetyCheckers_RmRegData) / sizeof(SafetyCheckers_RmRegData)); totalModule++)
-		{
-			for (regNum = 0U; regNum < gSafetyCheckers_RmRegData[totalModule].regNum; regNum++)
-			{
-				for (regArrayLen = 0U; regArrayLen < gSafetyCheckers_RmRegData[totalModule].regArrayLen; regArrayLen++)
-				{
-					uint32_t readData = (uint32_t)CSL_REG32_RD(gSafetyCheckers_RmRegData[totalModule].baseAddr +\
-					((gSafetyCheckers_RmRegData[totalModule].regStartOffset * regArrayLen) + gSafetyCheckers_RmRegData[totalModule].regOffsetArr[regNum]));			
-					mismatchCnt |= (uint32_t)(rmRegCfg[offset] ^ readData);
-					offset++;
-				}
-			}
-		}
-	}
-
-   if(mismatchCnt != 0U)
-   {
-       status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
-   }
-
-   return status;
+    {
+        SafetyCheckers_regSetBuildSigTree(&gSafetyCheckers_RmRegSetTable, rmSigTree,
+                                          SafetyCheckers_regSetGetCount(&gSafetyCheckers_RmRegSetTable));
+    }
+
+    return status;
+}
+
+int32_t SafetyCheckers_rmVerifyRegSigTree(const uint64_t *rmSigTree, uint64_t *rmSigTreeWork,
+                                          uint32_t size, SafetyCheckers_SigMismatch *mismatch)
+{
+    uint32_t totalReg;
+    uint32_t firstReg = 0U;
+    uint32_t regCount = 0U;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((rmSigTree == NULL) || (rmSigTreeWork == NULL))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (SAFETY_CHECKERS_SIG_TREE_SIZE > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        totalReg = SafetyCheckers_regSetGetCount(&gSafetyCheckers_RmRegSetTable);
+        SafetyCheckers_regSetBuildSigTree(&gSafetyCheckers_RmRegSetTable, rmSigTreeWork, totalReg);
+
+        status = SafetyCheckers_sigTreeCompare(rmSigTree, rmSigTreeWork, totalReg, &firstReg, &regCount);
+
+        if ((status == SAFETY_CHECKERS_REG_DATA_MISMATCH) && (mismatch != NULL))
+        {
+            SafetyCheckers_regSetGetLocation(&gSafetyCheckers_RmRegSetTable, firstReg, mismatch);
+            mismatch->regCount = regCount;
+        }
+    }
+
+    return status;
+}
+
+int32_t SafetyCheckers_rmLocateRegSigMismatch(const uintptr_t *rmRegCfg, uint32_t size,
+                                              SafetyCheckers_SigMismatch *mismatch)
+{
+    return SafetyCheckers_regSetLocateMismatch(&gSafetyCheckers_RmRegSetTable, rmRegCfg,
+                                               (uint32_t)sizeof(uintptr_t), size, mismatch);
+}
+
+int32_t SafetyCheckers_rmVerifyRegCfgSnapshot(const uintptr_t *rmRegCfg, uint32_t size,
+                                              const SafetyCheckers_SnapshotOps *snapshotOps,
+                                              uint32_t *scratch, uint32_t scratchSize)
+{
+    return SafetyCheckers_regSetVerifySnapshot(&gSafetyCheckers_RmRegSetTable, rmRegCfg, size,
+                                               snapshotOps, scratch, scratchSize);
+}
+
+int32_t SafetyCheckers_rmVerifyRegCfgPipelined(const uintptr_t *rmRegCfg, uint32_t size,
+                                               const SafetyCheckers_SnapshotOps *snapshotOps,
+                                               uint32_t *scratch, uint32_t scratchSize,
+                                               SafetyCheckers_GetTimeUsecFxn getTimeUsec,
+                                               SafetyCheckers_RmPipelineStats *stats)
+{
+    return SafetyCheckers_regSetVerifyPipelined(&gSafetyCheckers_RmRegSetTable, rmRegCfg, size,
+                                                snapshotOps, scratch, scratchSize, getTimeUsec, stats);
+}
+
+int32_t SafetyCheckers_rmVerifyStart(SafetyCheckers_RmVerifyCursor *cursor, const uintptr_t *rmRegCfg,
+                                     uint32_t size, SafetyCheckers_GetTimeUsecFxn getTimeUsec)
+{
+    uint32_t totalReg;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((cursor == NULL) || (rmRegCfg == NULL))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        totalReg = SafetyCheckers_regSetGetCount(&gSafetyCheckers_RmRegSetTable);
+        if (totalReg > size)
+        {
+            status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+        }
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        cursor->rmRegCfg    = rmRegCfg;
+        cursor->getTimeUsec = getTimeUsec;
+        cursor->totalReg    = totalReg;
+        SafetyCheckers_rmVerifyRewind(cursor);
+    }
+
+    return status;
+}
+
+int32_t SafetyCheckers_rmVerifyStep(SafetyCheckers_RmVerifyCursor *cursor, uint32_t maxReg, uint32_t maxTimeUsec)
+{
+    uint32_t regCnt = 0U;
+    uint32_t runCnt;
+    uint32_t maxCount;
+    uint32_t readData;
+    uint32_t mismatch;
+    uint32_t budgetDone = 0U;
+    uint64_t startTime = 0U;
+    SafetyCheckers_RegSetRun run;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((cursor == NULL) || (cursor->rmRegCfg == NULL))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (cursor->getTimeUsec != NULL))
+    {
+        startTime = cursor->getTimeUsec();
+    }
+
+    while ((status == SAFETY_CHECKERS_SOK) && (cursor->sweepDone == 0U) && (budgetDone == 0U))
+    {
+        /* Stop the run at the register budget and at the next time check */
+        maxCount = (maxReg > regCnt) ? (maxReg - regCnt) : 1U;
+        if ((cursor->getTimeUsec != NULL) &&
+            (maxCount > (SAFETY_CHECKERS_RM_VERIFY_TIME_CHECK_INTERVAL - (regCnt % SAFETY_CHECKERS_RM_VERIFY_TIME_CHECK_INTERVAL))))
+        {
+            maxCount = SAFETY_CHECKERS_RM_VERIFY_TIME_CHECK_INTERVAL - (regCnt % SAFETY_CHECKERS_RM_VERIFY_TIME_CHECK_INTERVAL);
+        }
+
+        /* Same order as SafetyCheckers_rmVerifyRegCfg: instances inside registers inside modules */
+        if (SafetyCheckers_regSetNextRun(&gSafetyCheckers_RmRegSetTable, &cursor->pos, maxCount, &run) != 0U)
+        {
+            for (runCnt = 0U; runCnt < run.count; runCnt++)
+            {
+                readData = (uint32_t)CSL_REG32_RD(run.regAddr + (run.stride * runCnt));
+                mismatch = SafetyCheckers_regCfgCompare(cursor->rmRegCfg, (uint32_t)sizeof(uintptr_t),
+                                                        cursor->regVerified, readData, run.mask);
+
+                if ((mismatch != 0U) && (cursor->firstMismatch == SAFETY_CHECKERS_RM_VERIFY_NO_MISMATCH))
+                {
+                    cursor->firstMismatch = cursor->regVerified;
+                }
+                cursor->mismatchCnt |= mismatch;
+                cursor->regVerified++;
+                regCnt++;
+            }
+        }
+
+        if ((cursor->pos.desc >= gSafetyCheckers_RmRegSetTable.numDesc) ||
+            (cursor->regVerified >= cursor->totalReg))
+        {
+            cursor->sweepDone = 1U;
+        }
+
+        if ((regCnt != 0U) && (regCnt >= maxReg))
+        {
+            budgetDone = 1U;
+        }
+        else if ((cursor->getTimeUsec != NULL) && (regCnt != 0U) &&
+                 ((regCnt % SAFETY_CHECKERS_RM_VERIFY_TIME_CHECK_INTERVAL) == 0U) &&
+                 ((cursor->getTimeUsec() - startTime) >= maxTimeUsec))
+        {
+            budgetDone = 1U;
+        }
+        else
+        {
+            /* Budget left, continue */
+        }
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (cursor->mismatchCnt != 0U))
+    {
+        status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
+    }
+
+    return status;
+}
+
+int32_t SafetyCheckers_rmVerifyFinish(SafetyCheckers_RmVerifyCursor *cursor)
+{
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if ((cursor == NULL) || (cursor->rmRegCfg == NULL) || (cursor->sweepDone == 0U))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (cursor->mismatchCnt != 0U))
+    {
+        status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
+    }
+
+    if (status != SAFETY_CHECKERS_FAIL)
+    {
+        SafetyCheckers_rmVerifyRewind(cursor);
+    }
+
+    return status;
+}
+
+/* ========================================================================== */
+/*                       Static Function Definitions                          */
+/* ========================================================================== */
+
+static void SafetyCheckers_rmGetRegSetDesc(uint32_t index, SafetyCheckers_RegSetDesc *desc)
+{
+    const SafetyCheckers_RmRegData *regData = &gSafetyCheckers_RmRegData[index];
+
+    /* regStartOffset is the distance between two instances of a module register */
+    desc->baseAddr   = regData->baseAddr;
+    desc->stride     = regData->regStartOffset;
+    desc->count      = regData->regArrayLen;
+    desc->offsetArr  = regData->regOffsetArr;
+    desc->numOffsets = regData->regNum;
+    desc->mask       = SAFETY_CHECKERS_REGSET_MASK_ALL;
+    desc->module     = index;
+}
+
+static void SafetyCheckers_rmGetModuleTable(uint32_t module, SafetyCheckers_RegSetTable *table)
+{
+    table->descArr   = NULL;
+    table->getDesc   = SafetyCheckers_rmGetRegSetDesc;
+    table->firstDesc = module;
+    table->numDesc   = 1U;
+}
+
+static void SafetyCheckers_rmVerifyRewind(SafetyCheckers_RmVerifyCursor *cursor)
+{
+    cursor->pos.desc      = 0U;
+    cursor->pos.offset    = 0U;
+    cursor->pos.instance  = 0U;
+    cursor->regVerified   = 0U;
+    cursor->firstMismatch = SAFETY_CHECKERS_RM_VERIFY_NO_MISMATCH;
+    cursor->sweepDone     = 0U;
+    cursor->mismatchCnt   = 0U;
 }
@@ -61,7 +61,7 @@
 /*                             Include Files                                  */
 /* ========================================================================== */
 
-/* None */
+#include <safety_checkers_common.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -81,6 +81,11 @@ extern "C" {
 /** \brief Maximum number of registers in a register group */
 #define SAFETY_CHECKERS_RM_MAX_REG_PER_GROUP							(20U)
 
+/** \brief No register mismatch found so far in the verify sweep */
+#define SAFETY_CHECKERS_RM_VERIFY_NO_MISMATCH                           (0xFFFFFFFFU)
+/** \brief Number of registers verified between two time budget checks */
+#define SAFETY_CHECKERS_RM_VERIFY_TIME_CHECK_INTERVAL                   (16U)
+
 /** @} */
 
 /* ========================================================================== */
@@ -120,6 +125,36 @@ typedef struct
     uint32_t regOffsetArr [SAFETY_CHECKERS_RM_MAX_REG_PER_GROUP];
 }  SafetyCheckers_RmRegData;
 
+/**
+ *
+ * \brief   Structure to hold the position and the partial result of a
+ *          time sliced RM verify sweep. It shall only be updated through
+ *          the SafetyCheckers_rmVerifyStart/Step/Finish APIs.
+ *
+ */
+typedef struct
+{
+    /* Pointer of the golden register configuration */
+    const uintptr_t *rmRegCfg;
+    /* Time stamp function used for the time budget, can be NULL */
+    SafetyCheckers_GetTimeUsecFxn getTimeUsec;
+    /* Position of the next register to be verified */
+    SafetyCheckers_RegSetPos pos;
+    /* Number of registers verified in the current sweep */
+    uint32_t regVerified;
+    /* Total number of registers in a sweep */
+    uint32_t totalReg;
+    /* Index of the first mismatching register of the current sweep */
+    uint32_t firstMismatch;
+    /* Set once every register has been verified in the current sweep */
+    uint32_t sweepDone;
+    /* Accumulated register mismatch of the current sweep */
+    uint32_t mismatchCnt;
+} SafetyCheckers_RmVerifyCursor;
+
+/** \brief Stage timing of a pipelined RM verify sweep */
+typedef SafetyCheckers_PipelineStats SafetyCheckers_RmPipelineStats;
+
 /** @} */
 
 /* ========================================================================== */
@@ -157,6 +192,18 @@ typedef struct
  */
 int32_t SafetyCheckers_rmGetRegCfg(uintptr_t *rmRegCfg, uint32_t size);
 
+/**
+ * \brief    Same as SafetyCheckers_rmGetRegCfg with a 32-bit RM register
+ *           configuration, e.g. the RM section of a packed golden image.
+ *
+ * \param    rmRegCfg          [IN/OUT]       Pointer of the 32-bit RM register configuration
+ * \param    size              [IN]           Size of register configuration memory
+ *
+ * \return   SAFETY_CHECKERS_SOK in case of success else failure
+ *
+ */
+int32_t SafetyCheckers_rmGetRegCfg32(uint32_t *rmRegCfg, uint32_t size);
+
 /**
  * \brief    API to read back and compare the RM control module registers data            
  *           E.g. When the RM verify register dump is requested,
@@ -173,6 +220,280 @@ int32_t SafetyCheckers_rmGetRegCfg(uintptr_t *rmRegCfg, uint32_t size);
  */
 int32_t SafetyCheckers_rmVerifyRegCfg(const uintptr_t *rmRegCfg, uint32_t size);
 
+/**
+ * \brief    Same as SafetyCheckers_rmVerifyRegCfg with a 32-bit RM register
+ *           configuration, e.g. the RM section of a packed golden image.
+ *
+ * \param    rmRegCfg          [IN]           Pointer of the 32-bit RM register configuration
+ * \param    size              [IN]           Size of register configuration memory
+ *
+ * \return   SAFETY_CHECKERS_SOK in case of success else failure
+ *
+ */
+int32_t SafetyCheckers_rmVerifyRegCfg32(const uint32_t *rmRegCfg, uint32_t size);
+
+#if defined (SAFETY_CHECKERS_RM_VERIFY_UNROLLED)
+/**
+ * \brief    Same as SafetyCheckers_rmVerifyRegCfg as a straight-line sequence of
+ *           register reads. It is only declared when the build defines
+ *           SAFETY_CHECKERS_RM_VERIFY_UNROLLED, which src/makefile does with
+ *           SAFETY_CHECKERS_RM_VERIFY_UNROLLED=yes together with adding
+ *           src/soc/<soc>/safety_checkers_verify_rm_soc.c, generated with
+ *           "utils/safety_checkers_verify_gen.py --rm".
+ *
+ * \param    rmRegCfg          [IN]           Pointer of the RM golden register configuration
+ * \param    size              [IN]           Size of golden configuration memory
+ *
+ * \return   SAFETY_CHECKERS_SOK in case of success else failure
+ *
+ */
+int32_t SafetyCheckers_rmVerifyRegCfgUnrolled(const uintptr_t *rmRegCfg, uint32_t size);
+#endif
+
+/**
+ * \brief    API to get the number of RM control modules (entries of gSafetyCheckers_RmRegData)
+ *
+ * \return   Number of RM control modules
+ *
+ */
+uint32_t SafetyCheckers_rmGetNumModules(void);
+
+/**
+ * \brief    API to get the number of registers read for one RM control module
+ *
+ * \param    module            [IN]           Index of the RM control module
+ *
+ * \return   Number of registers of the module, 0 for an invalid module
+ *
+ */
+uint32_t SafetyCheckers_rmGetModuleRegCount(uint32_t module);
+
+/**
+ * \brief    API to get the 32-bit register configuration of one RM control module.
+ *           The registers are stored in the same order as SafetyCheckers_rmGetRegCfg.
+ *
+ * \param    module            [IN]           Index of the RM control module
+ * \param    regCfg            [IN/OUT]       Pointer to store the register configuration
+ * \param    size              [IN]           Size of register configuration memory
+ *
+ * \return   SAFETY_CHECKERS_SOK in case of success,else failure.
+ *
+ */
+int32_t SafetyCheckers_rmGetModuleRegCfg32(uint32_t module, uint32_t *regCfg, uint32_t size);
+
+/**
+ * \brief    API to read back one RM control module and compare it against its
+ *           32-bit golden register configuration.
+ *
+ * \param    module            [IN]           Index of the RM control module
+ * \param    regCfg            [IN]           Pointer of the golden register configuration
+ * \param    size              [IN]           Size of golden configuration memory
+ *
+ * \return   SAFETY_CHECKERS_SOK in case of success else failure
+ *
+ */
+int32_t SafetyCheckers_rmVerifyModuleRegCfg32(uint32_t module, const uint32_t *regCfg, uint32_t size);
+
+/**
+ * \brief    API to get the signature of the RM register table (base addresses,
+ *           counts, strides and offsets). A golden sample is only valid for the
+ *           table it was taken with.
+ *
+ * \return   Signature of gSafetyCheckers_RmRegData
+ *
+ */
+uint64_t SafetyCheckers_rmGetTableSig(void);
+
+/**
+ * \brief    API to get the register signature for all the RM control modules
+ *           E.g. When the RM register signature is requested, SafetyCheckers_rmGetRegSig
+ *           reads the same registers as SafetyCheckers_rmGetRegCfg but folds them
+ *           into one 64-bit signature per SafetyCheckers_RmRegData module instead of
+ *           storing every register value. The collected signatures shall be considered
+ *           as the golden sample and need SAFETY_CHECKERS_RM_REGSIG_SIZE entries.
+ *
+ * \param    rmRegSig          [IN/OUT]       Pointer to store the module signatures
+ * \param    size              [IN]           Number of entries in rmRegSig
+ *
+ * \return   SAFETY_CHECKERS_SOK in case of success,else failure.
+ *
+ */
+int32_t SafetyCheckers_rmGetRegSig(uint64_t *rmRegSig, uint32_t size);
+
+/**
+ * \brief    API to read back the RM control module registers and compare their
+ *           signatures against the golden signatures.
+ *           E.g. When the RM verify register signature is requested,
+ *           SafetyCheckers_rmVerifyRegSig recomputes the signature of every
+ *           SafetyCheckers_RmRegData module and compares it with the received one.
+ *
+ * \param    rmRegSig          [IN]           Pointer of the golden signatures
+ * \param    size              [IN]           Number of entries in rmRegSig
+ *
+ * \return   SAFETY_CHECKERS_SOK in case of success else failure
+ *
+ */
+int32_t SafetyCheckers_rmVerifyRegSig(const uint64_t *rmRegSig, uint32_t size);
+
+/**
+ * \brief    API to get the register signature tree for the RM control modules
+ *           E.g. When the RM register signature tree is requested,
+ *           SafetyCheckers_rmGetRegSigTree reads the same registers as
+ *           SafetyCheckers_rmGetRegCfg and builds a tree of signatures over
+ *           equal ranges of them. The tree shall be considered as the golden
+ *           sample and needs SAFETY_CHECKERS_SIG_TREE_SIZE entries.
+ *
+ * \param    rmSigTree         [IN/OUT]       Pointer to store the signature tree
+ * \param    size              [IN]           Number of entries in rmSigTree
+ *
+ * \return   SAFETY_CHECKERS_SOK in case of success,else failure.
+ *
+ */
+int32_t SafetyCheckers_rmGetRegSigTree(uint64_t *rmSigTree, uint32_t size);
+
+/**
+ * \brief    API to read back the RM control module registers and compare their
+ *           signature tree against the golden signature tree.
+ *           E.g. When the RM verify register signature tree is requested,
+ *           SafetyCheckers_rmVerifyRegSigTree rebuilds the tree in rmSigTreeWork.
+ *           Only the roots are compared when the configuration matches. On a
+ *           mismatch the tree is walked down to the smallest mismatching range
+ *           and its first register is reported in mismatch. The range is one
+ *           leaf of the tree, which on J7 covers hundreds of registers, so
+ *           mismatch->regCount gives the extent of the fault. Use
+ *           SafetyCheckers_rmLocateRegSigMismatch to get the exact register.
+ *
+ * \param    rmSigTree         [IN]           Pointer of the golden signature tree
+ * \param    rmSigTreeWork     [IN/OUT]       Scratch memory for the current signature tree
+ * \param    size              [IN]           Number of entries in rmSigTree and rmSigTreeWork
+ * \param    mismatch          [OUT]          Location of the mismatch, can be NULL
+ *
+ * \return   SAFETY_CHECKERS_SOK in case of success else failure
+ *
+ */
+int32_t SafetyCheckers_rmVerifyRegSigTree(const uint64_t *rmSigTree, uint64_t *rmSigTreeWork,
+                                          uint32_t size, SafetyCheckers_SigMismatch *mismatch);
+
+/**
+ * \brief    API to narrow a mismatch reported by SafetyCheckers_rmVerifyRegSigTree
+ *           down to the exact RM control module register.
+ *           E.g. When the RM signature mismatch location is requested,
+ *           SafetyCheckers_rmLocateRegSigMismatch reads back only the registers
+ *           of the mismatching range and compares them against the golden
+ *           register configuration, e.g. one kept in flash. The first
+ *           mismatching register is reported in mismatch with regCount 1.
+ *
+ * \param    rmRegCfg          [IN]           Pointer of the golden register configuration
+ * \param    size              [IN]           Number of entries in rmRegCfg
+ * \param    mismatch          [IN/OUT]       Mismatch reported by SafetyCheckers_rmVerifyRegSigTree
+ *
+ * \return   SAFETY_CHECKERS_REG_DATA_MISMATCH when the register is found,
+ *           SAFETY_CHECKERS_SOK when the range matches rmRegCfg else failure
+ *
+ */
+int32_t SafetyCheckers_rmLocateRegSigMismatch(const uintptr_t *rmRegCfg, uint32_t size,
+                                              SafetyCheckers_SigMismatch *mismatch);
+
+/**
+ * \brief    API to read back the RM control module registers through a snapshot
+ *           backend and compare them against the golden register configuration.
+ *           E.g. When the RM snapshot verify is requested,
+ *           SafetyCheckers_rmVerifyRegCfgSnapshot copies every strided run of
+ *           register instances (one register of one SafetyCheckers_RmRegData
+ *           module) into scratch with snapshotOps and compares the copy with
+ *           rmRegCfg. Runs longer than scratchSize are copied in chunks and runs
+ *           shorter than the minCount of the backend are read by the CPU.
+ *
+ * \param    rmRegCfg          [IN]           Pointer of the golden register configuration
+ * \param    size              [IN]           Size of golden configuration memory
+ * \param    snapshotOps       [IN]           Snapshot backend
+ * \param    scratch           [IN/OUT]       Scratch memory for the register snapshot
+ * \param    scratchSize       [IN]           Number of registers fitting in scratch
+ *
+ * \return   SAFETY_CHECKERS_SOK in case of success else failure
+ *
+ */
+int32_t SafetyCheckers_rmVerifyRegCfgSnapshot(const uintptr_t *rmRegCfg, uint32_t size,
+                                              const SafetyCheckers_SnapshotOps *snapshotOps,
+                                              uint32_t *scratch, uint32_t scratchSize);
+
+/**
+ * \brief    API to read back the RM control module registers through a snapshot
+ *           backend with two snapshot buffers and compare them against the golden
+ *           register configuration.
+ *           E.g. When the RM pipelined verify is requested,
+ *           SafetyCheckers_rmVerifyRegCfgPipelined works like
+ *           SafetyCheckers_rmVerifyRegCfgSnapshot but starts the copy of the next
+ *           register run into the second buffer before comparing the current one,
+ *           so an asynchronous backend fetches while the CPU compares.
+ *
+ * \param    rmRegCfg          [IN]           Pointer of the golden register configuration
+ * \param    size              [IN]           Size of golden configuration memory
+ * \param    snapshotOps       [IN]           Snapshot backend
+ * \param    scratch           [IN/OUT]       Scratch memory for 2 * scratchSize registers
+ * \param    scratchSize       [IN]           Number of registers fitting in one snapshot buffer
+ * \param    getTimeUsec       [IN]           Time stamp function for the stage timing, can be NULL
+ * \param    stats             [OUT]          Stage timing of the sweep, can be NULL
+ *
+ * \return   SAFETY_CHECKERS_SOK in case of success else failure
+ *
+ */
+int32_t SafetyCheckers_rmVerifyRegCfgPipelined(const uintptr_t *rmRegCfg, uint32_t size,
+                                               const SafetyCheckers_SnapshotOps *snapshotOps,
+                                               uint32_t *scratch, uint32_t scratchSize,
+                                               SafetyCheckers_GetTimeUsecFxn getTimeUsec,
+                                               SafetyCheckers_RmPipelineStats *stats);
+
+/**
+ * \brief    API to start a time sliced verify sweep of the RM control module registers.
+ *           E.g. When a time sliced RM verify is requested, SafetyCheckers_rmVerifyStart
+ *           checks the golden register configuration and resets the cursor to the
+ *           first register. The registers are then verified in the same order as
+ *           SafetyCheckers_rmVerifyRegCfg by calling SafetyCheckers_rmVerifyStep.
+ *
+ * \param    cursor            [IN/OUT]       Cursor of the verify sweep
+ * \param    rmRegCfg          [IN]           Pointer of the golden register configuration
+ * \param    size              [IN]           Size of golden configuration memory
+ * \param    getTimeUsec       [IN]           Time stamp function for the time budget, can be NULL
+ *
+ * \return   SAFETY_CHECKERS_SOK in case of success else failure
+ *
+ */
+int32_t SafetyCheckers_rmVerifyStart(SafetyCheckers_RmVerifyCursor *cursor, const uintptr_t *rmRegCfg,
+                                     uint32_t size, SafetyCheckers_GetTimeUsecFxn getTimeUsec);
+
+/**
+ * \brief    API to verify the next slice of RM control module registers.
+ *           The step stops after maxReg registers or once maxTimeUsec micro seconds
+ *           have elapsed, whichever comes first. At least one register is verified
+ *           per step. The time budget is checked every
+ *           SAFETY_CHECKERS_RM_VERIFY_TIME_CHECK_INTERVAL registers and is ignored
+ *           when no time stamp function was given. sweepDone of the cursor is set
+ *           once every register has been verified.
+ *
+ * \param    cursor            [IN/OUT]       Cursor of the verify sweep
+ * \param    maxReg            [IN]           Maximum number of registers to verify
+ * \param    maxTimeUsec       [IN]           Time budget of the step in micro seconds
+ *
+ * \return   SAFETY_CHECKERS_SOK when no mismatch was found so far in the sweep,
+ *           SAFETY_CHECKERS_REG_DATA_MISMATCH when a mismatch was found, else failure
+ *
+ */
+int32_t SafetyCheckers_rmVerifyStep(SafetyCheckers_RmVerifyCursor *cursor, uint32_t maxReg, uint32_t maxTimeUsec);
+
+/**
+ * \brief    API to finish a time sliced RM verify sweep.
+ *           Returns the result of the full sweep and rewinds the cursor so the
+ *           next sweep can be started with SafetyCheckers_rmVerifyStep.
+ *
+ * \param    cursor            [IN/OUT]       Cursor of the verify sweep
+ *
+ * \return   SAFETY_CHECKERS_SOK when all the registers match, SAFETY_CHECKERS_REG_DATA_MISMATCH
+ *           on a mismatch and SAFETY_CHECKERS_FAIL when the sweep is not complete
+ *
+ */
+int32_t SafetyCheckers_rmVerifyFinish(SafetyCheckers_RmVerifyCursor *cursor);
+
 /** @} */
 
 /* ========================================================================== */
@@ -77,6 +77,16 @@
 /* ========================================================================== */
 
 static uint32_t SafetyCheckers_tifsGetFwlRegValue(uint32_t fwlId, uint32_t fwlRegion, uint32_t fwlReg);
+static void SafetyCheckers_tifsReadFwlRegion(uint32_t fwlId, uint32_t fwlRegion, SafetyCheckers_TifsFwlRegList *regList);
+static uint32_t SafetyCheckers_tifsVerifyFwlRegion(uint32_t fwlId, uint32_t fwlRegion, const SafetyCheckers_TifsFwlRegList *regList,
+                                                   uint32_t mode);
+static int32_t SafetyCheckers_tifsCheckFwlDirEntry(const SafetyCheckers_TifsFwlPackedConfig *packedCfg,
+                                                   const SafetyCheckers_TifsFwlDirEntry *fwlDir);
+static int32_t SafetyCheckers_tifsReqFwl(uint32_t msgType, uint32_t timeout);
+static int32_t SafetyCheckers_tifsReqFwlPost(SafetyCheckers_TifsFwlReq *fwlReq, uint32_t msgType, uint32_t timeout,
+                                             SafetyCheckers_TifsReqDoneFxn doneFxn, void *doneArg);
+static uint32_t SafetyCheckers_tifsSessionHoldDone(const SafetyCheckers_TifsSession *session);
+static int32_t SafetyCheckers_tifsSessionCloseFwl(SafetyCheckers_TifsSession *session);
 
 /* ========================================================================== */
 /*                          Function Definitions                              */
@@ -87,34 +97,12 @@ static uint32_t SafetyCheckers_tifsGetFwlRegValue(uint32_t fwlId, uint32_t fwlRe
 */
 int32_t SafetyCheckers_tifsReqFwlOpen(void)
 {
-    int32_t status = SAFETY_CHECKERS_SOK;
-
-    struct tisci_fwl_req request = {0};
-    struct tisci_fwl_resp response = {0};
-
-    Sciclient_ReqPrm_t  reqParam = {0};
-    Sciclient_RespPrm_t respParam = {0};
-
-    reqParam.messageType    = (uint16_t) SAFETY_CHECKERS_TIFS_FWL_OPEN;
-    reqParam.flags          = (uint32_t) TISCI_MSG_FLAG_AOP;
-    reqParam.pReqPayload    = (const uint8_t *) &request;
-    reqParam.reqPayloadSize = (uint32_t) sizeof (request);
-    reqParam.timeout        = (uint32_t) SAFETY_CHECKERS_DEFAULT_TIMEOUT;
-
-    respParam.flags           = (uint32_t) 0;   /* Populated by the API */
-    respParam.pRespPayload    = (uint8_t *) &response;
-    respParam.respPayloadSize = (uint32_t)  sizeof (response);
+    return SafetyCheckers_tifsReqFwl(SAFETY_CHECKERS_TIFS_FWL_OPEN, (uint32_t) SAFETY_CHECKERS_DEFAULT_TIMEOUT);
+}
 
-    status = Sciclient_service(&reqParam, &respParam);
-    if ((status == SAFETY_CHECKERS_SOK)  && (respParam.flags == TISCI_MSG_FLAG_ACK))
-    {
-        status = SAFETY_CHECKERS_SOK;
-    }
-    else
-    {
-        status = SAFETY_CHECKERS_FAIL;
-    }
-    return status;
+int32_t SafetyCheckers_tifsReqFwlOpenTimeout(uint32_t timeout)
+{
+    return SafetyCheckers_tifsReqFwl(SAFETY_CHECKERS_TIFS_FWL_OPEN, timeout);
 }
 
 /**
@@ -132,21 +120,7 @@ int32_t SafetyCheckers_tifsGetFwlCfg(SafetyCheckers_TifsFwlConfig *fwlConfig, ui
         {
             for (j = 0U; j<fwlConfig[i].numRegions; j++)
             {
-                /* Read control register from firewall registers */
-                fwlConfig[i].fwlCfgPerRegion[j].controlReg = SafetyCheckers_tifsGetFwlRegValue(id, j, SAFETY_CHECKERS_TIFS_CONTROL_REG);
-
-                /* Read permission registers from firewall registers */
-                fwlConfig[i].fwlCfgPerRegion[j].privId0 = SafetyCheckers_tifsGetFwlRegValue(id, j, SAFETY_CHECKERS_TIFS_PRIV_ID0);
-                fwlConfig[i].fwlCfgPerRegion[j].privId1 = SafetyCheckers_tifsGetFwlRegValue(id, j, SAFETY_CHECKERS_TIFS_PRIV_ID1);
-                fwlConfig[i].fwlCfgPerRegion[j].privId2 = SafetyCheckers_tifsGetFwlRegValue(id, j, SAFETY_CHECKERS_TIFS_PRIV_ID2);
-
-                /* Read start address from firewall registers */
-                fwlConfig[i].fwlCfgPerRegion[j].startAddrLow =  SafetyCheckers_tifsGetFwlRegValue(id, j, SAFETY_CHECKERS_TIFS_START_ADDRL);
-                fwlConfig[i].fwlCfgPerRegion[j].startAddrHigh = SafetyCheckers_tifsGetFwlRegValue(id, j, SAFETY_CHECKERS_TIFS_START_ADDRH);
-
-                /* Read end address from firewall register */
-                fwlConfig[i].fwlCfgPerRegion[j].endAddrLow =  SafetyCheckers_tifsGetFwlRegValue(id, j, SAFETY_CHECKERS_TIFS_END_ADDRL);
-                fwlConfig[i].fwlCfgPerRegion[j].endAddrHigh = SafetyCheckers_tifsGetFwlRegValue(id, j, SAFETY_CHECKERS_TIFS_END_ADDRH);
+                SafetyCheckers_tifsReadFwlRegion(id, j, &fwlConfig[i].fwlCfgPerRegion[j]);
             }
         }
         else
@@ -162,50 +136,97 @@ int32_t SafetyCheckers_tifsGetFwlCfg(SafetyCheckers_TifsFwlConfig *fwlConfig, ui
 */
 int32_t SafetyCheckers_tifsVerifyFwlCfg(const SafetyCheckers_TifsFwlConfig *fwlConfig, uint32_t size)
 {
-    uint32_t i = 0U, j = 0U, regData = 0U, id = 0U, mismatch = 0U;
+    return SafetyCheckers_tifsVerifyFwlCfgMode(fwlConfig, size, SAFETY_CHECKERS_TIFS_VERIFY_ALL);
+}
+
+int32_t SafetyCheckers_tifsVerifyFwlCfgMode(const SafetyCheckers_TifsFwlConfig *fwlConfig, uint32_t size, uint32_t mode)
+{
+    uint32_t i = 0U, j = 0U, id = 0U, mismatch = 0U;
     int32_t status = SAFETY_CHECKERS_SOK;
 
-    for (i = 0U; i<size; i++)
+    if ((mode != SAFETY_CHECKERS_TIFS_VERIFY_ALL) && (mode != SAFETY_CHECKERS_TIFS_VERIFY_SKIP_DISABLED))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    for (i = 0U; (status == SAFETY_CHECKERS_SOK) && (i < size); i++)
     {
         id = fwlConfig[i].fwlId;
         if (fwlConfig[i].numRegions <= fwlConfig[i].maxNumRegions)
         {
             for (j = 0U; j<fwlConfig[i].numRegions; j++)
             {
-                mismatch = 0U;
-
-                /* Read control register and check for mismatch */
-                regData = SafetyCheckers_tifsGetFwlRegValue(id, j, SAFETY_CHECKERS_TIFS_CONTROL_REG);
-                mismatch |= fwlConfig[i].fwlCfgPerRegion[j].controlReg ^ regData;
+                mismatch |= SafetyCheckers_tifsVerifyFwlRegion(id, j, &fwlConfig[i].fwlCfgPerRegion[j], mode);
+            }
+        }
+        else
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+    }
 
-                /* Read permission registers and check for mismatch */
-                regData = SafetyCheckers_tifsGetFwlRegValue(id, j, SAFETY_CHECKERS_TIFS_PRIV_ID0);
-                mismatch |= fwlConfig[i].fwlCfgPerRegion[j].privId0 ^ regData;
+    if ((status == SAFETY_CHECKERS_SOK) && (mismatch != 0U))
+    {
+        status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
+    }
+    return status;
+}
 
-                regData = SafetyCheckers_tifsGetFwlRegValue(id, j, SAFETY_CHECKERS_TIFS_PRIV_ID1);
-                mismatch |= fwlConfig[i].fwlCfgPerRegion[j].privId1 ^ regData;
+int32_t SafetyCheckers_tifsGetFwlPackedCfg(const SafetyCheckers_TifsFwlPackedConfig *packedCfg)
+{
+    uint32_t i = 0U, j = 0U;
+    const SafetyCheckers_TifsFwlDirEntry *fwlDir = NULL;
+    int32_t status = SAFETY_CHECKERS_SOK;
 
-                regData = SafetyCheckers_tifsGetFwlRegValue(id, j, SAFETY_CHECKERS_TIFS_PRIV_ID2);
-                mismatch |= fwlConfig[i].fwlCfgPerRegion[j].privId2 ^ regData;
+    if ((packedCfg == NULL) || (packedCfg->fwlDir == NULL) || (packedCfg->fwlRegions == NULL))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
 
-                /* Read start address and check for mismatch */
-                regData = SafetyCheckers_tifsGetFwlRegValue(id, j, SAFETY_CHECKERS_TIFS_START_ADDRL);
-                mismatch |= fwlConfig[i].fwlCfgPerRegion[j].startAddrLow ^ regData;
+    for (i = 0U; (status == SAFETY_CHECKERS_SOK) && (i < packedCfg->numFwl); i++)
+    {
+        fwlDir = &packedCfg->fwlDir[i];
+        if (SafetyCheckers_tifsCheckFwlDirEntry(packedCfg, fwlDir) == SAFETY_CHECKERS_SOK)
+        {
+            for (j = 0U; j < fwlDir->numRegions; j++)
+            {
+                SafetyCheckers_tifsReadFwlRegion(fwlDir->fwlId, j, &packedCfg->fwlRegions[fwlDir->regionOffset + j]);
+            }
+        }
+        else
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+    }
+    return status;
+}
 
-                regData = SafetyCheckers_tifsGetFwlRegValue(id, j, SAFETY_CHECKERS_TIFS_START_ADDRH);
-                mismatch |= fwlConfig[i].fwlCfgPerRegion[j].startAddrHigh ^ regData;
+int32_t SafetyCheckers_tifsVerifyFwlPackedCfg(const SafetyCheckers_TifsFwlPackedConfig *packedCfg)
+{
+    return SafetyCheckers_tifsVerifyFwlPackedCfgMode(packedCfg, SAFETY_CHECKERS_TIFS_VERIFY_ALL);
+}
 
-                /* Read end address and check for mismatch */
-                regData = SafetyCheckers_tifsGetFwlRegValue(id, j, SAFETY_CHECKERS_TIFS_END_ADDRL);
-                mismatch |= fwlConfig[i].fwlCfgPerRegion[j].endAddrLow ^ regData;
+int32_t SafetyCheckers_tifsVerifyFwlPackedCfgMode(const SafetyCheckers_TifsFwlPackedConfig *packedCfg, uint32_t mode)
+{
+    uint32_t i = 0U, j = 0U, mismatch = 0U;
+    const SafetyCheckers_TifsFwlDirEntry *fwlDir = NULL;
+    int32_t status = SAFETY_CHECKERS_SOK;
 
-                regData = SafetyCheckers_tifsGetFwlRegValue(id, j, SAFETY_CHECKERS_TIFS_END_ADDRH);
-                mismatch |= fwlConfig[i].fwlCfgPerRegion[j].endAddrHigh ^ regData;
+    if ((packedCfg == NULL) || (packedCfg->fwlDir == NULL) || (packedCfg->fwlRegions == NULL) ||
+        ((mode != SAFETY_CHECKERS_TIFS_VERIFY_ALL) && (mode != SAFETY_CHECKERS_TIFS_VERIFY_SKIP_DISABLED)))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
 
-                if(mismatch != 0U)
-                {
-                    status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
-                }
+    for (i = 0U; (status != SAFETY_CHECKERS_FAIL) && (i < packedCfg->numFwl); i++)
+    {
+        fwlDir = &packedCfg->fwlDir[i];
+        if (SafetyCheckers_tifsCheckFwlDirEntry(packedCfg, fwlDir) == SAFETY_CHECKERS_SOK)
+        {
+            for (j = 0U; j < fwlDir->numRegions; j++)
+            {
+                mismatch |= SafetyCheckers_tifsVerifyFwlRegion(fwlDir->fwlId, j, &packedCfg->fwlRegions[fwlDir->regionOffset + j],
+                                                               mode);
             }
         }
         else
@@ -213,6 +234,83 @@ int32_t SafetyCheckers_tifsVerifyFwlCfg(const SafetyCheckers_TifsFwlConfig *fwlC
             status = SAFETY_CHECKERS_FAIL;
         }
     }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (mismatch != 0U))
+    {
+        status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
+    }
+    return status;
+}
+
+int32_t SafetyCheckers_tifsGetFwlRegCfg32(uint32_t fwlId, uint32_t numRegions, uint32_t *regCfg, uint32_t size)
+{
+    uint32_t j = 0U, offset = 0U;
+    SafetyCheckers_TifsFwlRegList regList;
+    int32_t status = SAFETY_CHECKERS_SOK;
+
+    if ((regCfg == NULL) || (numRegions > SAFETY_CHECKERS_TIFS_MAX_REGIONS))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+    else if ((numRegions * SAFETY_CHECKERS_TIFS_REGS_PER_REGION) > size)
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+    else
+    {
+        for (j = 0U; j<numRegions; j++)
+        {
+            /* Registers of a region are contiguous, in SafetyCheckers_TifsFwlRegList order */
+            SafetyCheckers_tifsReadFwlRegion(fwlId, j, &regList);
+            regCfg[offset] = regList.controlReg;
+            regCfg[offset + 1U] = regList.privId0;
+            regCfg[offset + 2U] = regList.privId1;
+            regCfg[offset + 3U] = regList.privId2;
+            regCfg[offset + 4U] = regList.startAddrLow;
+            regCfg[offset + 5U] = regList.startAddrHigh;
+            regCfg[offset + 6U] = regList.endAddrLow;
+            regCfg[offset + 7U] = regList.endAddrHigh;
+            offset += SAFETY_CHECKERS_TIFS_REGS_PER_REGION;
+        }
+    }
+    return status;
+}
+
+int32_t SafetyCheckers_tifsVerifyFwlRegCfg32(uint32_t fwlId, uint32_t numRegions, const uint32_t *regCfg, uint32_t size)
+{
+    uint32_t j = 0U, offset = 0U, mismatch = 0U;
+    SafetyCheckers_TifsFwlRegList regList;
+    int32_t status = SAFETY_CHECKERS_SOK;
+
+    if ((regCfg == NULL) || (numRegions > SAFETY_CHECKERS_TIFS_MAX_REGIONS))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+    else if ((numRegions * SAFETY_CHECKERS_TIFS_REGS_PER_REGION) > size)
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+    else
+    {
+        for (j = 0U; j<numRegions; j++)
+        {
+            regList.controlReg = regCfg[offset];
+            regList.privId0 = regCfg[offset + 1U];
+            regList.privId1 = regCfg[offset + 2U];
+            regList.privId2 = regCfg[offset + 3U];
+            regList.startAddrLow = regCfg[offset + 4U];
+            regList.startAddrHigh = regCfg[offset + 5U];
+            regList.endAddrLow = regCfg[offset + 6U];
+            regList.endAddrHigh = regCfg[offset + 7U];
+            mismatch |= SafetyCheckers_tifsVerifyFwlRegion(fwlId, j, &regList, SAFETY_CHECKERS_TIFS_VERIFY_ALL);
+            offset += SAFETY_CHECKERS_TIFS_REGS_PER_REGION;
+        }
+
+        if(mismatch != 0U)
+        {
+            status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
+        }
+    }
     return status;
 }
 
@@ -221,34 +319,242 @@ int32_t SafetyCheckers_tifsVerifyFwlCfg(const SafetyCheckers_TifsFwlConfig *fwlC
 */
 int32_t SafetyCheckers_tifsReqFwlClose(void)
 {
-    int32_t status = SAFETY_CHECKERS_SOK;
+    return SafetyCheckers_tifsReqFwl(SAFETY_CHECKERS_TIFS_FWL_CLOSE, (uint32_t) SAFETY_CHECKERS_DEFAULT_TIMEOUT);
+}
 
-    struct tisci_fwl_req request;
-    struct tisci_fwl_resp response;
+int32_t SafetyCheckers_tifsReqFwlCloseTimeout(uint32_t timeout)
+{
+    return SafetyCheckers_tifsReqFwl(SAFETY_CHECKERS_TIFS_FWL_CLOSE, timeout);
+}
 
-    Sciclient_ReqPrm_t  reqParam = {0};
-    Sciclient_RespPrm_t respParam = {0};
+int32_t SafetyCheckers_tifsReqFwlOpenAsync(SafetyCheckers_TifsFwlReq *fwlReq, uint32_t timeout,
+                                           SafetyCheckers_TifsReqDoneFxn doneFxn, void *doneArg)
+{
+    return SafetyCheckers_tifsReqFwlPost(fwlReq, SAFETY_CHECKERS_TIFS_FWL_OPEN, timeout, doneFxn, doneArg);
+}
 
-    reqParam.messageType    = (uint16_t) SAFETY_CHECKERS_TIFS_FWL_CLOSE;
-    reqParam.flags          = (uint32_t) TISCI_MSG_FLAG_AOP;
-    reqParam.pReqPayload    = (const uint8_t *) &request;
-    reqParam.reqPayloadSize = (uint32_t) sizeof (request);
-    reqParam.timeout        = (uint32_t) SAFETY_CHECKERS_DEFAULT_TIMEOUT;
+int32_t SafetyCheckers_tifsReqFwlCloseAsync(SafetyCheckers_TifsFwlReq *fwlReq, uint32_t timeout,
+                                            SafetyCheckers_TifsReqDoneFxn doneFxn, void *doneArg)
+{
+    return SafetyCheckers_tifsReqFwlPost(fwlReq, SAFETY_CHECKERS_TIFS_FWL_CLOSE, timeout, doneFxn, doneArg);
+}
 
-    respParam.flags           = (uint32_t) 0;   /* Populated by the API */
-    respParam.pRespPayload    = (uint8_t *) &response;
-    respParam.respPayloadSize = (uint32_t)  sizeof (response);
+int32_t SafetyCheckers_tifsReqFwlProcess(SafetyCheckers_TifsFwlReq *fwlReq)
+{
+    int32_t  status = SAFETY_CHECKERS_SOK;
+    int32_t  reqStatus;
+    uint32_t msgType;
+    uint32_t timeout;
+    SafetyCheckers_TifsReqDoneFxn doneFxn;
+    void    *doneArg;
+
+    if ((fwlReq == NULL) || (fwlReq->state != SAFETY_CHECKERS_TIFS_REQ_PENDING))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+    else
+    {
+        /* The request can be re-posted as soon as it is done, only the local copies are used after that */
+        msgType = fwlReq->msgType;
+        timeout = fwlReq->timeout;
+        doneFxn = fwlReq->doneFxn;
+        doneArg = fwlReq->doneArg;
+
+        reqStatus = SafetyCheckers_tifsReqFwl(msgType, timeout);
 
-   status = Sciclient_service(&reqParam, &respParam);
-   if((status == SAFETY_CHECKERS_SOK) && (respParam.flags == TISCI_MSG_FLAG_ACK))
-   {
+        /* Last stores to the request, the status is published before the state */
+        fwlReq->reqStatus = reqStatus;
+        fwlReq->state     = SAFETY_CHECKERS_TIFS_REQ_DONE;
+
+        if (doneFxn != NULL)
+        {
+            doneFxn(doneArg, reqStatus);
+        }
+    }
+    return status;
+}
+
+int32_t SafetyCheckers_tifsReqFwlPoll(const SafetyCheckers_TifsFwlReq *fwlReq, int32_t *reqStatus)
+{
+    int32_t status = SAFETY_CHECKERS_FAIL;
+
+    if ((fwlReq != NULL) && (reqStatus != NULL) && (fwlReq->state == SAFETY_CHECKERS_TIFS_REQ_DONE))
+    {
+        *reqStatus = fwlReq->reqStatus;
         status = SAFETY_CHECKERS_SOK;
-   }
-   else
-   {
+    }
+    return status;
+}
+
+int32_t SafetyCheckers_tifsSessionInit(SafetyCheckers_TifsSession *session,
+                                       SafetyCheckers_GetTimeUsecFxn getTimeUsec, uint64_t maxHoldUsec,
+                                       SafetyCheckers_TifsLockFxn lock, SafetyCheckers_TifsLockFxn unlock,
+                                       void *lockArg)
+{
+    int32_t status = SAFETY_CHECKERS_SOK;
+
+    if ((session == NULL) || ((lock == NULL) != (unlock == NULL)))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+    else
+    {
+        session->lock        = lock;
+        session->unlock      = unlock;
+        session->lockArg     = lockArg;
+        session->getTimeUsec = getTimeUsec;
+        session->maxHoldUsec = maxHoldUsec;
+        session->openTime    = 0U;
+        session->refCnt      = 0U;
+        session->isOpen      = 0U;
+        session->openCnt     = 0U;
+    }
+    return status;
+}
+
+int32_t SafetyCheckers_tifsSessionAcquire(SafetyCheckers_TifsSession *session)
+{
+    int32_t status = SAFETY_CHECKERS_SOK;
+
+    if (session == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+    else
+    {
+        if (session->lock != NULL)
+        {
+            session->lock(session->lockArg);
+        }
+
+        /* Refresh an idle window that is past its hold time */
+        if ((session->isOpen == 1U) && (session->refCnt == 0U) && (SafetyCheckers_tifsSessionHoldDone(session) == 1U))
+        {
+            status = SafetyCheckers_tifsSessionCloseFwl(session);
+        }
+
+        if ((status == SAFETY_CHECKERS_SOK) && (session->isOpen == 0U))
+        {
+            status = SafetyCheckers_tifsReqFwlOpen();
+            session->openCnt++;
+            if (status == SAFETY_CHECKERS_SOK)
+            {
+                session->isOpen   = 1U;
+                session->openTime = (session->getTimeUsec != NULL) ? session->getTimeUsec() : 0U;
+            }
+        }
+
+        if (status == SAFETY_CHECKERS_SOK)
+        {
+            session->refCnt++;
+        }
+
+        if (session->unlock != NULL)
+        {
+            session->unlock(session->lockArg);
+        }
+    }
+    return status;
+}
+
+int32_t SafetyCheckers_tifsSessionRelease(SafetyCheckers_TifsSession *session)
+{
+    int32_t status = SAFETY_CHECKERS_SOK;
+
+    if (session == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+    else
+    {
+        if (session->lock != NULL)
+        {
+            session->lock(session->lockArg);
+        }
+
+        if (session->refCnt == 0U)
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+        else
+        {
+            session->refCnt--;
+            if ((session->refCnt == 0U) && (SafetyCheckers_tifsSessionHoldDone(session) == 1U))
+            {
+                status = SafetyCheckers_tifsSessionCloseFwl(session);
+            }
+        }
+
+        if (session->unlock != NULL)
+        {
+            session->unlock(session->lockArg);
+        }
+    }
+    return status;
+}
+
+int32_t SafetyCheckers_tifsSessionPoll(SafetyCheckers_TifsSession *session)
+{
+    int32_t status = SAFETY_CHECKERS_SOK;
+
+    if (session == NULL)
+    {
         status = SAFETY_CHECKERS_FAIL;
-   }
-   return status;
+    }
+    else
+    {
+        if (session->lock != NULL)
+        {
+            session->lock(session->lockArg);
+        }
+
+        if ((session->isOpen == 1U) && (session->refCnt == 0U) && (SafetyCheckers_tifsSessionHoldDone(session) == 1U))
+        {
+            status = SafetyCheckers_tifsSessionCloseFwl(session);
+        }
+
+        if (session->unlock != NULL)
+        {
+            session->unlock(session->lockArg);
+        }
+    }
+    return status;
+}
+
+int32_t SafetyCheckers_tifsSessionClose(SafetyCheckers_TifsSession *session)
+{
+    int32_t status = SAFETY_CHECKERS_SOK;
+
+    if (session == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+    else
+    {
+        if (session->lock != NULL)
+        {
+            session->lock(session->lockArg);
+        }
+
+        if (session->refCnt != 0U)
+        {
+            status = SAFETY_CHECKERS_FAIL;
+        }
+        else if (session->isOpen == 1U)
+        {
+            status = SafetyCheckers_tifsSessionCloseFwl(session);
+        }
+        else
+        {
+            /* Already closed */
+        }
+
+        if (session->unlock != NULL)
+        {
+            session->unlock(session->lockArg);
+        }
+    }
+    return status;
 }
 
 /* ========================================================================== */
@@ -264,3 +570,171 @@ static uint32_t SafetyCheckers_tifsGetFwlRegValue(uint32_t fwlId, uint32_t fwlRe
     fwlRegValue = CSL_REG32_RD(fwlRegionOffset + fwlReg);
     return fwlRegValue;
 }
+
+static uint32_t SafetyCheckers_tifsSessionHoldDone(const SafetyCheckers_TifsSession *session)
+{
+    uint32_t holdDone = 1U;
+
+    /* Without a time stamp function the firewall is closed as soon as the session is idle */
+    if ((session->getTimeUsec != NULL) &&
+        ((session->getTimeUsec() - session->openTime) < session->maxHoldUsec))
+    {
+        holdDone = 0U;
+    }
+    return holdDone;
+}
+
+static int32_t SafetyCheckers_tifsSessionCloseFwl(SafetyCheckers_TifsSession *session)
+{
+    int32_t status;
+
+    /* On failure the firewall is still considered open so the close is retried */
+    status = SafetyCheckers_tifsReqFwlClose();
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        session->isOpen = 0U;
+    }
+    return status;
+}
+
+static int32_t SafetyCheckers_tifsReqFwl(uint32_t msgType, uint32_t timeout)
+{
+    int32_t status = SAFETY_CHECKERS_SOK;
+
+    struct tisci_fwl_req request = {0};
+    struct tisci_fwl_resp response = {0};
+
+    Sciclient_ReqPrm_t  reqParam = {0};
+    Sciclient_RespPrm_t respParam = {0};
+
+    reqParam.messageType    = (uint16_t) msgType;
+    reqParam.flags          = (uint32_t) TISCI_MSG_FLAG_AOP;
+    reqParam.pReqPayload    = (const uint8_t *) &request;
+    reqParam.reqPayloadSize = (uint32_t) sizeof (request);
+    reqParam.timeout        = timeout;
+
+    respParam.flags           = (uint32_t) 0;   /* Populated by the API */
+    respParam.pRespPayload    = (uint8_t *) &response;
+    respParam.respPayloadSize = (uint32_t)  sizeof (response);
+
+    status = Sciclient_service(&reqParam, &respParam);
+    if ((status == SAFETY_CHECKERS_SOK)  && (respParam.flags == TISCI_MSG_FLAG_ACK))
+    {
+        status = SAFETY_CHECKERS_SOK;
+    }
+    else
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+    return status;
+}
+
+static int32_t SafetyCheckers_tifsReqFwlPost(SafetyCheckers_TifsFwlReq *fwlReq, uint32_t msgType, uint32_t timeout,
+                                             SafetyCheckers_TifsReqDoneFxn doneFxn, void *doneArg)
+{
+    int32_t status = SAFETY_CHECKERS_SOK;
+
+    if ((fwlReq == NULL) || (fwlReq->state == SAFETY_CHECKERS_TIFS_REQ_PENDING))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+    else
+    {
+        fwlReq->msgType   = msgType;
+        fwlReq->timeout   = timeout;
+        fwlReq->doneFxn   = doneFxn;
+        fwlReq->doneArg   = doneArg;
+        fwlReq->reqStatus = SAFETY_CHECKERS_FAIL;
+        /* Set last, the request is picked up by SafetyCheckers_tifsReqFwlProcess once pending */
+        fwlReq->state     = SAFETY_CHECKERS_TIFS_REQ_PENDING;
+    }
+    return status;
+}
+
+static void SafetyCheckers_tifsReadFwlRegion(uint32_t fwlId, uint32_t fwlRegion, SafetyCheckers_TifsFwlRegList *regList)
+{
+    uint32_t fwlRegionAddr = 0U;
+#if (SAFETY_CHECKERS_TIFS_FWL_WIDE_READ == 1U)
+    uint64_t regData[SAFETY_CHECKERS_TIFS_REGS_PER_REGION / 2U];
+    uint32_t i = 0U;
+#endif
+
+    fwlRegionAddr = SAFETY_CHECKERS_TIFS_FWL_BASE + (0x400U * fwlId) + (0x20U * fwlRegion);
+
+#if (SAFETY_CHECKERS_TIFS_FWL_WIDE_READ == 1U)
+    /* Read the 32-byte region block as four 64-bit words, lower register in the lower half */
+    for (i = 0U; i < (SAFETY_CHECKERS_TIFS_REGS_PER_REGION / 2U); i++)
+    {
+        regData[i] = CSL_REG64_RD(fwlRegionAddr + (0x8U * i));
+    }
+
+    regList->controlReg = (uint32_t)regData[0];
+    regList->privId0 = (uint32_t)(regData[0] >> 32U);
+    regList->privId1 = (uint32_t)regData[1];
+    regList->privId2 = (uint32_t)(regData[1] >> 32U);
+    regList->startAddrLow = (uint32_t)regData[2];
+    regList->startAddrHigh = (uint32_t)(regData[2] >> 32U);
+    regList->endAddrLow = (uint32_t)regData[3];
+    regList->endAddrHigh = (uint32_t)(regData[3] >> 32U);
+#else
+    /* Read control register from firewall registers */
+    regList->controlReg = CSL_REG32_RD(fwlRegionAddr + SAFETY_CHECKERS_TIFS_CONTROL_REG);
+
+    /* Read permission registers from firewall registers */
+    regList->privId0 = CSL_REG32_RD(fwlRegionAddr + SAFETY_CHECKERS_TIFS_PRIV_ID0);
+    regList->privId1 = CSL_REG32_RD(fwlRegionAddr + SAFETY_CHECKERS_TIFS_PRIV_ID1);
+    regList->privId2 = CSL_REG32_RD(fwlRegionAddr + SAFETY_CHECKERS_TIFS_PRIV_ID2);
+
+    /* Read start address from firewall registers */
+    regList->startAddrLow = CSL_REG32_RD(fwlRegionAddr + SAFETY_CHECKERS_TIFS_START_ADDRL);
+    regList->startAddrHigh = CSL_REG32_RD(fwlRegionAddr + SAFETY_CHECKERS_TIFS_START_ADDRH);
+
+    /* Read end address from firewall register */
+    regList->endAddrLow = CSL_REG32_RD(fwlRegionAddr + SAFETY_CHECKERS_TIFS_END_ADDRL);
+    regList->endAddrHigh = CSL_REG32_RD(fwlRegionAddr + SAFETY_CHECKERS_TIFS_END_ADDRH);
+#endif
+}
+
+static uint32_t SafetyCheckers_tifsVerifyFwlRegion(uint32_t fwlId, uint32_t fwlRegion, const SafetyCheckers_TifsFwlRegList *regList,
+                                                   uint32_t mode)
+{
+    uint32_t mismatch = 0U;
+    SafetyCheckers_TifsFwlRegList regData;
+
+    if ((mode == SAFETY_CHECKERS_TIFS_VERIFY_SKIP_DISABLED) &&
+        ((regList->controlReg & SAFETY_CHECKERS_TIFS_CONTROL_ENABLE_MASK) != SAFETY_CHECKERS_TIFS_CONTROL_ENABLE))
+    {
+        /* A region disabled in the golden reference only has to stay disabled */
+        mismatch = regList->controlReg ^
+                   SafetyCheckers_tifsGetFwlRegValue(fwlId, fwlRegion, SAFETY_CHECKERS_TIFS_CONTROL_REG);
+    }
+    else
+    {
+        /* Read the whole region and compare it in one go */
+        SafetyCheckers_tifsReadFwlRegion(fwlId, fwlRegion, &regData);
+
+        mismatch = (regList->controlReg ^ regData.controlReg) |
+                   (regList->privId0 ^ regData.privId0) |
+                   (regList->privId1 ^ regData.privId1) |
+                   (regList->privId2 ^ regData.privId2) |
+                   (regList->startAddrLow ^ regData.startAddrLow) |
+                   (regList->startAddrHigh ^ regData.startAddrHigh) |
+                   (regList->endAddrLow ^ regData.endAddrLow) |
+                   (regList->endAddrHigh ^ regData.endAddrHigh);
+    }
+
+    return mismatch;
+}
+
+static int32_t SafetyCheckers_tifsCheckFwlDirEntry(const SafetyCheckers_TifsFwlPackedConfig *packedCfg,
+                                                   const SafetyCheckers_TifsFwlDirEntry *fwlDir)
+{
+    int32_t status = SAFETY_CHECKERS_SOK;
+
+    if ((fwlDir->numRegions > fwlDir->maxNumRegions) ||
+        (((uint32_t)fwlDir->regionOffset + (uint32_t)fwlDir->maxNumRegions) > packedCfg->numRegions))
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+    return status;
+}
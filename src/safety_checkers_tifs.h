@@ -62,7 +62,7 @@
 /*                             Include Files                                  */
 /* ========================================================================== */
 
-/* None */
+#include <safety_checkers_common.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -92,6 +92,33 @@ extern "C" {
 #define SAFETY_CHECKERS_TIFS_END_ADDRL             0x18U
 #define SAFETY_CHECKERS_TIFS_END_ADDRH             0x1CU
 #define SAFETY_CHECKERS_TIFS_MAX_REGIONS           36U
+#define SAFETY_CHECKERS_TIFS_REGS_PER_REGION       8U
+#define SAFETY_CHECKERS_TIFS_CONTROL_ENABLE_MASK   0xFU
+#define SAFETY_CHECKERS_TIFS_CONTROL_ENABLE        0xAU
+
+/** \brief Firewall regions are read as four 64-bit words when set to 1U, else one
+ *         32-bit register at a time. The firewall configuration space is only
+ *         documented for 32-bit accesses in the SoC TRMs, so wide reads are off
+ *         by default; a build may enable them for a SoC whose TRM allows 64-bit
+ *         accesses to the firewall region registers */
+#if !defined (SAFETY_CHECKERS_TIFS_FWL_WIDE_READ)
+#define SAFETY_CHECKERS_TIFS_FWL_WIDE_READ         0U
+#endif
+
+/** \brief Firewall verify modes: every register of a region, or only the
+ *         control register of the regions disabled in the golden reference */
+#define SAFETY_CHECKERS_TIFS_VERIFY_ALL            0U
+#define SAFETY_CHECKERS_TIFS_VERIFY_SKIP_DISABLED  1U
+
+/** \brief States of an asynchronous firewall request */
+#define SAFETY_CHECKERS_TIFS_REQ_IDLE              0U
+#define SAFETY_CHECKERS_TIFS_REQ_PENDING           1U
+#define SAFETY_CHECKERS_TIFS_REQ_DONE              2U
+
+/** \brief Function taking or giving the lock of a firewall session shared by several tasks */
+typedef void (*SafetyCheckers_TifsLockFxn)(void *arg);
+/** \brief Function called with the status once an asynchronous firewall request is done */
+typedef void (*SafetyCheckers_TifsReqDoneFxn)(void *arg, int32_t reqStatus);
 
 /** @} */
 
@@ -138,6 +165,82 @@ typedef struct
     SafetyCheckers_TifsFwlRegList fwlCfgPerRegion[SAFETY_CHECKERS_TIFS_MAX_REGIONS]; /* Firewall registers for a given region */
 } SafetyCheckers_TifsFwlConfig;
 
+/**
+ *
+ * \brief   Structure for one firewall of a packed firewall configuration.
+ *          The regions of the firewall are the maxNumRegions entries of the
+ *          shared region array starting at regionOffset.
+ *
+ */
+typedef struct
+{
+    uint16_t fwlId; /* Firewall id */
+    uint16_t regionOffset; /* Index of the first region of the firewall in the region array */
+    uint16_t numRegions; /* Number of regions stored in the firewall config for an id */
+    uint16_t maxNumRegions; /* Maximum number of regions present in an id */
+} SafetyCheckers_TifsFwlDirEntry;
+
+/**
+ *
+ * \brief   Structure for a packed firewall configuration: a directory of
+ *          firewalls indexing one region array sized by the sum of their
+ *          maxNumRegions, instead of SAFETY_CHECKERS_TIFS_MAX_REGIONS regions
+ *          per firewall as in SafetyCheckers_TifsFwlConfig.
+ *
+ */
+typedef struct
+{
+    SafetyCheckers_TifsFwlDirEntry *fwlDir; /* Firewall directory */
+    uint32_t numFwl; /* Number of entries of fwlDir */
+    SafetyCheckers_TifsFwlRegList *fwlRegions; /* Shared region array */
+    uint32_t numRegions; /* Number of entries of fwlRegions */
+} SafetyCheckers_TifsFwlPackedConfig;
+
+/**
+ *
+ * \brief   Structure for a reference counted firewall session. The firewall
+ *          is opened by the first SafetyCheckers_tifsSessionAcquire and stays
+ *          open while the session is held, so several checks share one
+ *          open/close round trip. It shall only be updated through the
+ *          SafetyCheckers_tifsSession APIs.
+ *
+ */
+typedef struct
+{
+    SafetyCheckers_TifsLockFxn lock; /* Takes the session lock, can be NULL */
+    SafetyCheckers_TifsLockFxn unlock; /* Gives the session lock, can be NULL */
+    void *lockArg; /* Argument of the lock functions */
+    SafetyCheckers_GetTimeUsecFxn getTimeUsec; /* Time stamp function for the hold time, can be NULL */
+    uint64_t maxHoldUsec; /* Time after which an idle open firewall is closed */
+    uint64_t openTime; /* Time stamp of the last firewall open */
+    uint32_t refCnt; /* Number of holders of the session */
+    uint32_t isOpen; /* 1 while the firewall is open */
+    uint32_t openCnt; /* Number of firewall open requests sent */
+} SafetyCheckers_TifsSession;
+
+/**
+ *
+ * \brief   Structure for an asynchronous firewall open or close request. The
+ *          request is posted by the checker task and sent to TIFS by
+ *          SafetyCheckers_tifsReqFwlProcess from a worker context. It shall be
+ *          zero initialized before its first use and only be updated through the
+ *          SafetyCheckers_tifsReqFwl APIs. Every field is shared between the
+ *          posting and the processing task and is volatile, so the request is
+ *          written before state is published and read after it is seen. Post
+ *          checks and sets state without an atomic operation, so the callers
+ *          shall serialize the tasks posting the same request.
+ *
+ */
+typedef struct
+{
+    volatile uint32_t msgType; /* SAFETY_CHECKERS_TIFS_FWL_OPEN or SAFETY_CHECKERS_TIFS_FWL_CLOSE */
+    volatile uint32_t timeout; /* Sciclient timeout of the request */
+    SafetyCheckers_TifsReqDoneFxn volatile doneFxn; /* Completion function, can be NULL */
+    void * volatile doneArg; /* Argument of the completion function */
+    volatile int32_t reqStatus; /* Status of the request once done */
+    volatile uint32_t state; /* SAFETY_CHECKERS_TIFS_REQ_IDLE, _PENDING or _DONE */
+} SafetyCheckers_TifsFwlReq;
+
 /** @} */
 
 /**
@@ -159,6 +262,17 @@ typedef struct
  */
 int32_t SafetyCheckers_tifsReqFwlOpen(void);
 
+/**
+ * \brief   API to request TIFS to open firewall, waiting at most timeout for
+ *          the response instead of SAFETY_CHECKERS_DEFAULT_TIMEOUT.
+ *
+ * \param   timeout    [IN]        Sciclient timeout of the request
+ *
+ * \return  status   SAFETY_CHECKERS_SOK : Success
+ *                   SAFETY_CHECKERS_FAIL: Failure or timeout
+ */
+int32_t SafetyCheckers_tifsReqFwlOpenTimeout(uint32_t timeout);
+
 /**
  * \brief   API uses the pointer to firewall configuration fwlConfig as input and
  *          updates fwlConfig with the register dump of the firewall registers specified.
@@ -187,6 +301,102 @@ int32_t SafetyCheckers_tifsGetFwlCfg(SafetyCheckers_TifsFwlConfig *fwlConfig, ui
  */
 int32_t SafetyCheckers_tifsVerifyFwlCfg(const SafetyCheckers_TifsFwlConfig *fwlConfig, uint32_t size);
 
+/**
+ * \brief   API compares the fwlConfig (golden reference) with runtime firewall
+ *          register values like SafetyCheckers_tifsVerifyFwlCfg. With
+ *          SAFETY_CHECKERS_TIFS_VERIFY_SKIP_DISABLED the control register is
+ *          read first and, for a region disabled in the golden reference, it is
+ *          the only register verified: the region has to stay disabled but its
+ *          permission and address registers are not read.
+ *
+ * \param   fwlConfig  [IN]        Pointer to static firewall configuration / Golden Reference to
+ *                                 be verified against
+ *
+ * \param   size       [IN]        Number of entries in the static firewall configuration
+ *
+ * \param   mode       [IN]        SAFETY_CHECKERS_TIFS_VERIFY_ALL or SAFETY_CHECKERS_TIFS_VERIFY_SKIP_DISABLED
+ *
+ * \return  status   SAFETY_CHECKERS_SOK : Success
+ *                   SAFETY_CHECKERS_REG_DATA_MISMATCH: Register mismatch
+ *                   SAFETY_CHECKERS_FAIL: Failure
+ */
+int32_t SafetyCheckers_tifsVerifyFwlCfgMode(const SafetyCheckers_TifsFwlConfig *fwlConfig, uint32_t size, uint32_t mode);
+
+/**
+ * \brief   API updates the region array of a packed firewall configuration with
+ *          the register dump of the firewalls of its directory.
+ *
+ * \param   packedCfg  [IN/OUT]    Pointer to the packed firewall configuration
+ *
+ * \return  status   SAFETY_CHECKERS_SOK : Success
+ *                   SAFETY_CHECKERS_FAIL: Failure
+ */
+int32_t SafetyCheckers_tifsGetFwlPackedCfg(const SafetyCheckers_TifsFwlPackedConfig *packedCfg);
+
+/**
+ * \brief   API compares a packed firewall configuration (golden reference) with
+ *          runtime firewall register values.
+ *
+ * \param   packedCfg  [IN]        Pointer to the packed firewall configuration
+ *
+ * \return  status   SAFETY_CHECKERS_SOK : Success
+ *                   SAFETY_CHECKERS_REG_DATA_MISMATCH: Register mismatch
+ *                   SAFETY_CHECKERS_FAIL: Failure
+ */
+int32_t SafetyCheckers_tifsVerifyFwlPackedCfg(const SafetyCheckers_TifsFwlPackedConfig *packedCfg);
+
+/**
+ * \brief   API compares a packed firewall configuration (golden reference) with
+ *          runtime firewall register values, in the verify mode of
+ *          SafetyCheckers_tifsVerifyFwlCfgMode.
+ *
+ * \param   packedCfg  [IN]        Pointer to the packed firewall configuration
+ *
+ * \param   mode       [IN]        SAFETY_CHECKERS_TIFS_VERIFY_ALL or SAFETY_CHECKERS_TIFS_VERIFY_SKIP_DISABLED
+ *
+ * \return  status   SAFETY_CHECKERS_SOK : Success
+ *                   SAFETY_CHECKERS_REG_DATA_MISMATCH: Register mismatch
+ *                   SAFETY_CHECKERS_FAIL: Failure
+ */
+int32_t SafetyCheckers_tifsVerifyFwlPackedCfgMode(const SafetyCheckers_TifsFwlPackedConfig *packedCfg, uint32_t mode);
+
+/**
+ * \brief   API reads the registers of the first numRegions regions of one firewall
+ *          into a flat 32-bit array, eight words per region in the order of
+ *          SafetyCheckers_TifsFwlRegList.
+ *
+ * \param   fwlId      [IN]        Firewall id
+ *
+ * \param   numRegions [IN]        Number of regions to read
+ *
+ * \param   regCfg     [IN/OUT]    Pointer to store the register values
+ *
+ * \param   size       [IN]        Size of regCfg in words
+ *
+ * \return  status   SAFETY_CHECKERS_SOK : Success
+ *                   SAFETY_CHECKERS_INSUFFICIENT_BUFF: regCfg is too small
+ *                   SAFETY_CHECKERS_FAIL: Failure
+ */
+int32_t SafetyCheckers_tifsGetFwlRegCfg32(uint32_t fwlId, uint32_t numRegions, uint32_t *regCfg, uint32_t size);
+
+/**
+ * \brief   API compares a flat 32-bit array from SafetyCheckers_tifsGetFwlRegCfg32
+ *          (golden reference) with runtime firewall register values.
+ *
+ * \param   fwlId      [IN]        Firewall id
+ *
+ * \param   numRegions [IN]        Number of regions to verify
+ *
+ * \param   regCfg     [IN]        Pointer to the golden register values
+ *
+ * \param   size       [IN]        Size of regCfg in words
+ *
+ * \return  status   SAFETY_CHECKERS_SOK : Success
+ *                   SAFETY_CHECKERS_REG_DATA_MISMATCH: Register mismatch
+ *                   SAFETY_CHECKERS_FAIL: Failure
+ */
+int32_t SafetyCheckers_tifsVerifyFwlRegCfg32(uint32_t fwlId, uint32_t numRegions, const uint32_t *regCfg, uint32_t size);
+
 /**
  * \brief   API to request TIFS to close firewall
  *
@@ -196,6 +406,154 @@ int32_t SafetyCheckers_tifsVerifyFwlCfg(const SafetyCheckers_TifsFwlConfig *fwlC
  */
 int32_t SafetyCheckers_tifsReqFwlClose(void);
 
+/**
+ * \brief   API to request TIFS to close firewall, waiting at most timeout for
+ *          the response instead of SAFETY_CHECKERS_DEFAULT_TIMEOUT.
+ *
+ * \param   timeout    [IN]        Sciclient timeout of the request
+ *
+ * \return  status   SAFETY_CHECKERS_SOK : Success
+ *                   SAFETY_CHECKERS_FAIL: Failure or timeout
+ */
+int32_t SafetyCheckers_tifsReqFwlCloseTimeout(uint32_t timeout);
+
+/**
+ * \brief   API to post a firewall open request and return without waiting.
+ *          Sciclient_service blocks, so the request is sent by
+ *          SafetyCheckers_tifsReqFwlProcess, called from a worker task, and
+ *          its completion is reported through doneFxn and
+ *          SafetyCheckers_tifsReqFwlPoll. The pending check and the update of
+ *          the request are not atomic: concurrent posters of the same request
+ *          shall be serialized by the caller.
+ *
+ * \param   fwlReq     [IN/OUT]    Pointer to the request, not pending
+ *
+ * \param   timeout    [IN]        Sciclient timeout of the request
+ *
+ * \param   doneFxn    [IN]        Completion function, can be NULL
+ *
+ * \param   doneArg    [IN]        Argument of the completion function
+ *
+ * \return  status   SAFETY_CHECKERS_SOK : Request posted
+ *                   SAFETY_CHECKERS_FAIL: Failure, or the request is still pending
+ */
+int32_t SafetyCheckers_tifsReqFwlOpenAsync(SafetyCheckers_TifsFwlReq *fwlReq, uint32_t timeout,
+                                           SafetyCheckers_TifsReqDoneFxn doneFxn, void *doneArg);
+
+/**
+ * \brief   API to post a firewall close request and return without waiting,
+ *          like SafetyCheckers_tifsReqFwlOpenAsync.
+ *
+ * \param   fwlReq     [IN/OUT]    Pointer to the request, not pending
+ *
+ * \param   timeout    [IN]        Sciclient timeout of the request
+ *
+ * \param   doneFxn    [IN]        Completion function, can be NULL
+ *
+ * \param   doneArg    [IN]        Argument of the completion function
+ *
+ * \return  status   SAFETY_CHECKERS_SOK : Request posted
+ *                   SAFETY_CHECKERS_FAIL: Failure, or the request is still pending
+ */
+int32_t SafetyCheckers_tifsReqFwlCloseAsync(SafetyCheckers_TifsFwlReq *fwlReq, uint32_t timeout,
+                                            SafetyCheckers_TifsReqDoneFxn doneFxn, void *doneArg);
+
+/**
+ * \brief   API to send a pending asynchronous firewall request to TIFS, to be
+ *          called from the worker task. It blocks for at most the timeout of
+ *          the request, then marks it done and calls its completion function.
+ *          The request is not accessed once it is marked done, so it can be
+ *          re-posted from the completion function or by a poller.
+ *
+ * \param   fwlReq     [IN/OUT]    Pointer to the pending request
+ *
+ * \return  status   SAFETY_CHECKERS_SOK : Request processed, see its status
+ *                   SAFETY_CHECKERS_FAIL: Failure, or no request pending
+ */
+int32_t SafetyCheckers_tifsReqFwlProcess(SafetyCheckers_TifsFwlReq *fwlReq);
+
+/**
+ * \brief   API to poll an asynchronous firewall request.
+ *
+ * \param   fwlReq     [IN]        Pointer to the request
+ *
+ * \param   reqStatus  [OUT]       Status of the request once done
+ *
+ * \return  status   SAFETY_CHECKERS_SOK : Request done, reqStatus is valid
+ *                   SAFETY_CHECKERS_FAIL: Request not done yet, or failure
+ */
+int32_t SafetyCheckers_tifsReqFwlPoll(const SafetyCheckers_TifsFwlReq *fwlReq, int32_t *reqStatus);
+
+/**
+ * \brief   API to initialize a firewall session. The firewall is not opened.
+ *
+ * \param   session     [OUT]       Pointer to the firewall session
+ *
+ * \param   getTimeUsec [IN]        Time stamp function for the hold time, can be NULL
+ *
+ * \param   maxHoldUsec [IN]        Time after which an idle open firewall is closed
+ *
+ * \param   lock        [IN]        Function taking the session lock, can be NULL
+ *
+ * \param   unlock      [IN]        Function giving the session lock, can be NULL
+ *
+ * \param   lockArg     [IN]        Argument of the lock functions
+ *
+ * \return  status   SAFETY_CHECKERS_SOK : Success
+ *                   SAFETY_CHECKERS_FAIL: Failure
+ */
+int32_t SafetyCheckers_tifsSessionInit(SafetyCheckers_TifsSession *session,
+                                       SafetyCheckers_GetTimeUsecFxn getTimeUsec, uint64_t maxHoldUsec,
+                                       SafetyCheckers_TifsLockFxn lock, SafetyCheckers_TifsLockFxn unlock,
+                                       void *lockArg);
+
+/**
+ * \brief   API to hold a firewall session. The firewall is opened when it is
+ *          not open yet. An idle firewall held open for maxHoldUsec or more is
+ *          closed and opened again, so one open window never lasts longer than
+ *          the hold time plus the time the session is held.
+ *
+ * \param   session     [IN/OUT]    Pointer to the firewall session
+ *
+ * \return  status   SAFETY_CHECKERS_SOK : Success, the firewall is open
+ *                   SAFETY_CHECKERS_FAIL: Failure
+ */
+int32_t SafetyCheckers_tifsSessionAcquire(SafetyCheckers_TifsSession *session);
+
+/**
+ * \brief   API to release a firewall session held by SafetyCheckers_tifsSessionAcquire.
+ *          The last holder closes the firewall once it has been open for
+ *          maxHoldUsec or more, or always when no time stamp function was given.
+ *          Otherwise it stays open for the next check.
+ *
+ * \param   session     [IN/OUT]    Pointer to the firewall session
+ *
+ * \return  status   SAFETY_CHECKERS_SOK : Success
+ *                   SAFETY_CHECKERS_FAIL: Failure
+ */
+int32_t SafetyCheckers_tifsSessionRelease(SafetyCheckers_TifsSession *session);
+
+/**
+ * \brief   API to close the firewall of an idle session once it has been open
+ *          for maxHoldUsec or more, e.g. from a periodic task.
+ *
+ * \param   session     [IN/OUT]    Pointer to the firewall session
+ *
+ * \return  status   SAFETY_CHECKERS_SOK : Success
+ *                   SAFETY_CHECKERS_FAIL: Failure
+ */
+int32_t SafetyCheckers_tifsSessionPoll(SafetyCheckers_TifsSession *session);
+
+/**
+ * \brief   API to close the firewall of an idle session now.
+ *
+ * \param   session     [IN/OUT]    Pointer to the firewall session
+ *
+ * \return  status   SAFETY_CHECKERS_SOK : Success
+ *                   SAFETY_CHECKERS_FAIL: Failure, or the session is held
+ */
+int32_t SafetyCheckers_tifsSessionClose(SafetyCheckers_TifsSession *session);
+
 #ifdef __cplusplus
 }
 #endif
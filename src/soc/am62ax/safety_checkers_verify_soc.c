@@ -0,0 +1,365 @@
+/*
+ *  Copyright (C) 2024 Texas Instruments Incorporated
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ *  \file     safety_checkers_verify_soc.c
+ *
+ *  \brief    Unrolled PM register verify routines for am62ax.
+ *            Generated by utils/safety_checkers_verify_gen.py from
+ *            safety_checkers_soc.h, do not edit.
+ *
+ */
+
+/* ========================================================================== */
+/*                               Include Files                                */
+/* ========================================================================== */
+
+#include <stdint.h>
+#include <cslr.h>
+#include <safety_checkers_pm.h>
+#include <safety_checkers_common.h>
+#include <safety_checkers_soc.h>
+
+/* ========================================================================== */
+/*                            Function Definitions                            */
+/* ========================================================================== */
+
+int32_t SafetyCheckers_pmVerifyPscRegCfgUnrolled(const uintptr_t *pscRegCfg, uint32_t size)
+{
+    uint32_t mismatchCnt = 0U;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (pscRegCfg == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (SAFETY_CHECKERS_PM_PSC_FLAT_NUM > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        /* PSC 0: SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS */
+        mismatchCnt |= (uint32_t)pscRegCfg[0U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x200U);
+        mismatchCnt |= (uint32_t)pscRegCfg[1U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x204U);
+        mismatchCnt |= (uint32_t)pscRegCfg[2U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x800U);
+        mismatchCnt |= (uint32_t)pscRegCfg[3U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x804U);
+        mismatchCnt |= (uint32_t)pscRegCfg[4U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x808U);
+        mismatchCnt |= (uint32_t)pscRegCfg[5U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x80CU);
+        mismatchCnt |= (uint32_t)pscRegCfg[6U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x810U);
+        mismatchCnt |= (uint32_t)pscRegCfg[7U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x814U);
+        mismatchCnt |= (uint32_t)pscRegCfg[8U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x818U);
+        mismatchCnt |= (uint32_t)pscRegCfg[9U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x81CU);
+        mismatchCnt |= (uint32_t)pscRegCfg[10U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x820U);
+        mismatchCnt |= (uint32_t)pscRegCfg[11U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x824U);
+        mismatchCnt |= (uint32_t)pscRegCfg[12U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x828U);
+        /* PSC 1: SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS */
+        mismatchCnt |= (uint32_t)pscRegCfg[13U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x200U);
+        mismatchCnt |= (uint32_t)pscRegCfg[14U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x204U);
+        mismatchCnt |= (uint32_t)pscRegCfg[15U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x208U);
+        mismatchCnt |= (uint32_t)pscRegCfg[16U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x20CU);
+        mismatchCnt |= (uint32_t)pscRegCfg[17U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x210U);
+        mismatchCnt |= (uint32_t)pscRegCfg[18U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x214U);
+        mismatchCnt |= (uint32_t)pscRegCfg[19U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x218U);
+        mismatchCnt |= (uint32_t)pscRegCfg[20U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x21CU);
+        mismatchCnt |= (uint32_t)pscRegCfg[21U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x220U);
+        mismatchCnt |= (uint32_t)pscRegCfg[22U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x224U);
+        mismatchCnt |= (uint32_t)pscRegCfg[23U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x228U);
+        mismatchCnt |= (uint32_t)pscRegCfg[24U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x22CU);
+        mismatchCnt |= (uint32_t)pscRegCfg[25U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x230U);
+        mismatchCnt |= (uint32_t)pscRegCfg[26U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x234U);
+        mismatchCnt |= (uint32_t)pscRegCfg[27U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x800U);
+        mismatchCnt |= (uint32_t)pscRegCfg[28U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x804U);
+        mismatchCnt |= (uint32_t)pscRegCfg[29U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x808U);
+        mismatchCnt |= (uint32_t)pscRegCfg[30U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x80CU);
+        mismatchCnt |= (uint32_t)pscRegCfg[31U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x810U);
+        mismatchCnt |= (uint32_t)pscRegCfg[32U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x814U);
+        mismatchCnt |= (uint32_t)pscRegCfg[33U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x818U);
+        mismatchCnt |= (uint32_t)pscRegCfg[34U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x81CU);
+        mismatchCnt |= (uint32_t)pscRegCfg[35U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x820U);
+        mismatchCnt |= (uint32_t)pscRegCfg[36U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x824U);
+        mismatchCnt |= (uint32_t)pscRegCfg[37U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x828U);
+        mismatchCnt |= (uint32_t)pscRegCfg[38U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x82CU);
+        mismatchCnt |= (uint32_t)pscRegCfg[39U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x830U);
+        mismatchCnt |= (uint32_t)pscRegCfg[40U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x834U);
+        mismatchCnt |= (uint32_t)pscRegCfg[41U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x838U);
+        mismatchCnt |= (uint32_t)pscRegCfg[42U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x83CU);
+        mismatchCnt |= (uint32_t)pscRegCfg[43U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x840U);
+        mismatchCnt |= (uint32_t)pscRegCfg[44U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x844U);
+        mismatchCnt |= (uint32_t)pscRegCfg[45U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x848U);
+        mismatchCnt |= (uint32_t)pscRegCfg[46U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x84CU);
+        mismatchCnt |= (uint32_t)pscRegCfg[47U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x850U);
+        mismatchCnt |= (uint32_t)pscRegCfg[48U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x854U);
+        mismatchCnt |= (uint32_t)pscRegCfg[49U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x858U);
+        mismatchCnt |= (uint32_t)pscRegCfg[50U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x85CU);
+        mismatchCnt |= (uint32_t)pscRegCfg[51U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x860U);
+        mismatchCnt |= (uint32_t)pscRegCfg[52U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x864U);
+        mismatchCnt |= (uint32_t)pscRegCfg[53U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x868U);
+        mismatchCnt |= (uint32_t)pscRegCfg[54U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x86CU);
+        mismatchCnt |= (uint32_t)pscRegCfg[55U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x870U);
+        mismatchCnt |= (uint32_t)pscRegCfg[56U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x874U);
+        mismatchCnt |= (uint32_t)pscRegCfg[57U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x878U);
+        mismatchCnt |= (uint32_t)pscRegCfg[58U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x87CU);
+        mismatchCnt |= (uint32_t)pscRegCfg[59U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x880U);
+        mismatchCnt |= (uint32_t)pscRegCfg[60U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x884U);
+        mismatchCnt |= (uint32_t)pscRegCfg[61U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x888U);
+        mismatchCnt |= (uint32_t)pscRegCfg[62U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x88CU);
+        mismatchCnt |= (uint32_t)pscRegCfg[63U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x890U);
+        mismatchCnt |= (uint32_t)pscRegCfg[64U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x894U);
+        mismatchCnt |= (uint32_t)pscRegCfg[65U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x898U);
+        mismatchCnt |= (uint32_t)pscRegCfg[66U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x89CU);
+        mismatchCnt |= (uint32_t)pscRegCfg[67U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8A0U);
+        mismatchCnt |= (uint32_t)pscRegCfg[68U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8A4U);
+        mismatchCnt |= (uint32_t)pscRegCfg[69U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8A8U);
+        mismatchCnt |= (uint32_t)pscRegCfg[70U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8ACU);
+        mismatchCnt |= (uint32_t)pscRegCfg[71U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8B0U);
+        mismatchCnt |= (uint32_t)pscRegCfg[72U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8B4U);
+        mismatchCnt |= (uint32_t)pscRegCfg[73U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8B8U);
+        mismatchCnt |= (uint32_t)pscRegCfg[74U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8BCU);
+        mismatchCnt |= (uint32_t)pscRegCfg[75U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8C0U);
+        mismatchCnt |= (uint32_t)pscRegCfg[76U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8C4U);
+        mismatchCnt |= (uint32_t)pscRegCfg[77U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8C8U);
+        mismatchCnt |= (uint32_t)pscRegCfg[78U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8CCU);
+        mismatchCnt |= (uint32_t)pscRegCfg[79U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8D0U);
+        mismatchCnt |= (uint32_t)pscRegCfg[80U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8D4U);
+        mismatchCnt |= (uint32_t)pscRegCfg[81U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8D8U);
+        mismatchCnt |= (uint32_t)pscRegCfg[82U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8DCU);
+        mismatchCnt |= (uint32_t)pscRegCfg[83U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8E0U);
+        mismatchCnt |= (uint32_t)pscRegCfg[84U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8E4U);
+        mismatchCnt |= (uint32_t)pscRegCfg[85U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8E8U);
+        mismatchCnt |= (uint32_t)pscRegCfg[86U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8ECU);
+        mismatchCnt |= (uint32_t)pscRegCfg[87U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8F0U);
+        mismatchCnt |= (uint32_t)pscRegCfg[88U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8F4U);
+        mismatchCnt |= (uint32_t)pscRegCfg[89U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8F8U);
+
+        if (mismatchCnt != 0U)
+        {
+            status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
+        }
+    }
+
+    return status;
+}
+
+int32_t SafetyCheckers_pmVerifyPllRegCfgUnrolled(const uintptr_t *pllRegCfg, uint32_t size)
+{
+    uint32_t mismatchCnt = 0U;
+    int32_t  status = SAFETY_CHECKERS_SOK;
+
+    if (pllRegCfg == NULL)
+    {
+        status = SAFETY_CHECKERS_FAIL;
+    }
+
+    if ((status == SAFETY_CHECKERS_SOK) && (SAFETY_CHECKERS_PM_PLL_FLAT_NUM > size))
+    {
+        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;
+    }
+
+    if (status == SAFETY_CHECKERS_SOK)
+    {
+        /* PLL 0: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) */
+        mismatchCnt |= (uint32_t)pllRegCfg[0U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x00U);
+        mismatchCnt |= (uint32_t)pllRegCfg[1U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x08U);
+        mismatchCnt |= (uint32_t)pllRegCfg[2U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x20U);
+        mismatchCnt |= (uint32_t)pllRegCfg[3U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x24U);
+        mismatchCnt |= (uint32_t)pllRegCfg[4U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x30U);
+        mismatchCnt |= (uint32_t)pllRegCfg[5U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x34U);
+        mismatchCnt |= (uint32_t)pllRegCfg[6U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x38U);
+        mismatchCnt |= (uint32_t)pllRegCfg[7U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x40U);
+        mismatchCnt |= (uint32_t)pllRegCfg[8U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x44U);
+        mismatchCnt |= (uint32_t)pllRegCfg[9U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x60U);
+        mismatchCnt |= (uint32_t)pllRegCfg[10U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x64U);
+        mismatchCnt |= (uint32_t)pllRegCfg[11U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x80U);
+        mismatchCnt |= (uint32_t)pllRegCfg[12U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x84U);
+        mismatchCnt |= (uint32_t)pllRegCfg[13U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x88U);
+        mismatchCnt |= (uint32_t)pllRegCfg[14U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x8CU);
+        mismatchCnt |= (uint32_t)pllRegCfg[15U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x90U);
+        mismatchCnt |= (uint32_t)pllRegCfg[16U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x94U);
+        mismatchCnt |= (uint32_t)pllRegCfg[17U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x98U);
+        mismatchCnt |= (uint32_t)pllRegCfg[18U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x9CU);
+        mismatchCnt |= (uint32_t)pllRegCfg[19U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0xA0U);
+        mismatchCnt |= (uint32_t)pllRegCfg[20U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0xA4U);
+        /* PLL 1: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) */
+        mismatchCnt |= (uint32_t)pllRegCfg[21U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x00U);
+        mismatchCnt |= (uint32_t)pllRegCfg[22U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x08U);
+        mismatchCnt |= (uint32_t)pllRegCfg[23U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x20U);
+        mismatchCnt |= (uint32_t)pllRegCfg[24U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x24U);
+        mismatchCnt |= (uint32_t)pllRegCfg[25U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x30U);
+        mismatchCnt |= (uint32_t)pllRegCfg[26U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x34U);
+        mismatchCnt |= (uint32_t)pllRegCfg[27U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x38U);
+        mismatchCnt |= (uint32_t)pllRegCfg[28U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x40U);
+        mismatchCnt |= (uint32_t)pllRegCfg[29U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x44U);
+        mismatchCnt |= (uint32_t)pllRegCfg[30U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x60U);
+        mismatchCnt |= (uint32_t)pllRegCfg[31U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x64U);
+        mismatchCnt |= (uint32_t)pllRegCfg[32U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x80U);
+        mismatchCnt |= (uint32_t)pllRegCfg[33U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x84U);
+        mismatchCnt |= (uint32_t)pllRegCfg[34U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x88U);
+        mismatchCnt |= (uint32_t)pllRegCfg[35U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x8CU);
+        mismatchCnt |= (uint32_t)pllRegCfg[36U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x90U);
+        mismatchCnt |= (uint32_t)pllRegCfg[37U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x94U);
+        mismatchCnt |= (uint32_t)pllRegCfg[38U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x98U);
+        /* PLL 2: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) */
+        mismatchCnt |= (uint32_t)pllRegCfg[39U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x00U);
+        mismatchCnt |= (uint32_t)pllRegCfg[40U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x08U);
+        mismatchCnt |= (uint32_t)pllRegCfg[41U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x20U);
+        mismatchCnt |= (uint32_t)pllRegCfg[42U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x24U);
+        mismatchCnt |= (uint32_t)pllRegCfg[43U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x30U);
+        mismatchCnt |= (uint32_t)pllRegCfg[44U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x34U);
+        mismatchCnt |= (uint32_t)pllRegCfg[45U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x38U);
+        mismatchCnt |= (uint32_t)pllRegCfg[46U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x40U);
+        mismatchCnt |= (uint32_t)pllRegCfg[47U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x44U);
+        mismatchCnt |= (uint32_t)pllRegCfg[48U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x60U);
+        mismatchCnt |= (uint32_t)pllRegCfg[49U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x64U);
+        mismatchCnt |= (uint32_t)pllRegCfg[50U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x80U);
+        mismatchCnt |= (uint32_t)pllRegCfg[51U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x84U);
+        mismatchCnt |= (uint32_t)pllRegCfg[52U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x88U);
+        mismatchCnt |= (uint32_t)pllRegCfg[53U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x8CU);
+        mismatchCnt |= (uint32_t)pllRegCfg[54U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x90U);
+        mismatchCnt |= (uint32_t)pllRegCfg[55U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x94U);
+        mismatchCnt |= (uint32_t)pllRegCfg[56U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x98U);
+        mismatchCnt |= (uint32_t)pllRegCfg[57U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x9CU);
+        mismatchCnt |= (uint32_t)pllRegCfg[58U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0xA0U);
+        mismatchCnt |= (uint32_t)pllRegCfg[59U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0xA4U);
+        /* PLL 3: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) */
+        mismatchCnt |= (uint32_t)pllRegCfg[60U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x00U);
+        mismatchCnt |= (uint32_t)pllRegCfg[61U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x08U);
+        mismatchCnt |= (uint32_t)pllRegCfg[62U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x20U);
+        mismatchCnt |= (uint32_t)pllRegCfg[63U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x24U);
+        mismatchCnt |= (uint32_t)pllRegCfg[64U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x30U);
+        mismatchCnt |= (uint32_t)pllRegCfg[65U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x34U);
+        mismatchCnt |= (uint32_t)pllRegCfg[66U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x38U);
+        mismatchCnt |= (uint32_t)pllRegCfg[67U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x40U);
+        mismatchCnt |= (uint32_t)pllRegCfg[68U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x44U);
+        mismatchCnt |= (uint32_t)pllRegCfg[69U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x60U);
+        mismatchCnt |= (uint32_t)pllRegCfg[70U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x64U);
+        mismatchCnt |= (uint32_t)pllRegCfg[71U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x80U);
+        mismatchCnt |= (uint32_t)pllRegCfg[72U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x84U);
+        mismatchCnt |= (uint32_t)pllRegCfg[73U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x88U);
+        /* PLL 4: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) */
+        mismatchCnt |= (uint32_t)pllRegCfg[74U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x00U);
+        mismatchCnt |= (uint32_t)pllRegCfg[75U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x08U);
+        mismatchCnt |= (uint32_t)pllRegCfg[76U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x20U);
+        mismatchCnt |= (uint32_t)pllRegCfg[77U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x24U);
+        mismatchCnt |= (uint32_t)pllRegCfg[78U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x30U);
+        mismatchCnt |= (uint32_t)pllRegCfg[79U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x34U);
+        mismatchCnt |= (uint32_t)pllRegCfg[80U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x38U);
+        mismatchCnt |= (uint32_t)pllRegCfg[81U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x40U);
+        mismatchCnt |= (uint32_t)pllRegCfg[82U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x44U);
+        mismatchCnt |= (uint32_t)pllRegCfg[83U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x60U);
+        mismatchCnt |= (uint32_t)pllRegCfg[84U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x64U);
+        mismatchCnt |= (uint32_t)pllRegCfg[85U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x80U);
+        /* PLL 5: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) */
+        mismatchCnt |= (uint32_t)pllRegCfg[86U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x00U);
+        mismatchCnt |= (uint32_t)pllRegCfg[87U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x08U);
+        mismatchCnt |= (uint32_t)pllRegCfg[88U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x20U);
+        mismatchCnt |= (uint32_t)pllRegCfg[89U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x24U);
+        mismatchCnt |= (uint32_t)pllRegCfg[90U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x30U);
+        mismatchCnt |= (uint32_t)pllRegCfg[91U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x34U);
+        mismatchCnt |= (uint32_t)pllRegCfg[92U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x38U);
+        mismatchCnt |= (uint32_t)pllRegCfg[93U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x40U);
+        mismatchCnt |= (uint32_t)pllRegCfg[94U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x44U);
+        mismatchCnt |= (uint32_t)pllRegCfg[95U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x60U);
+        mismatchCnt |= (uint32_t)pllRegCfg[96U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x64U);
+        mismatchCnt |= (uint32_t)pllRegCfg[97U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x80U);
+        /* PLL 6: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) */
+        mismatchCnt |= (uint32_t)pllRegCfg[98U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x00U);
+        mismatchCnt |= (uint32_t)pllRegCfg[99U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x08U);
+        mismatchCnt |= (uint32_t)pllRegCfg[100U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x20U);
+        mismatchCnt |= (uint32_t)pllRegCfg[101U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x24U);
+        mismatchCnt |= (uint32_t)pllRegCfg[102U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x30U);
+        mismatchCnt |= (uint32_t)pllRegCfg[103U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x34U);
+        mismatchCnt |= (uint32_t)pllRegCfg[104U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x38U);
+        mismatchCnt |= (uint32_t)pllRegCfg[105U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x40U);
+        mismatchCnt |= (uint32_t)pllRegCfg[106U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x44U);
+        mismatchCnt |= (uint32_t)pllRegCfg[107U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x60U);
+        mismatchCnt |= (uint32_t)pllRegCfg[108U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x64U);
+        mismatchCnt |= (uint32_t)pllRegCfg[109U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x80U);
+        /* PLL 7: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) */
+        mismatchCnt |= (uint32_t)pllRegCfg[110U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x00U);
+        mismatchCnt |= (uint32_t)pllRegCfg[111U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x08U);
+        mismatchCnt |= (uint32_t)pllRegCfg[112U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x20U);
+        mismatchCnt |= (uint32_t)pllRegCfg[113U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x24U);
+        mismatchCnt |= (uint32_t)pllRegCfg[114U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x30U);
+        mismatchCnt |= (uint32_t)pllRegCfg[115U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x34U);
+        mismatchCnt |= (uint32_t)pllRegCfg[116U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x38U);
+        mismatchCnt |= (uint32_t)pllRegCfg[117U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x40U);
+        mismatchCnt |= (uint32_t)pllRegCfg[118U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x44U);
+        mismatchCnt |= (uint32_t)pllRegCfg[119U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x60U);
+        mismatchCnt |= (uint32_t)pllRegCfg[120U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x64U);
+        mismatchCnt |= (uint32_t)pllRegCfg[121U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x80U);
+        mismatchCnt |= (uint32_t)pllRegCfg[122U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x84U);
+        mismatchCnt |= (uint32_t)pllRegCfg[123U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x88U);
+        /* PLL 8: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) */
+        mismatchCnt |= (uint32_t)pllRegCfg[124U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x00U);
+        mismatchCnt |= (uint32_t)pllRegCfg[125U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x08U);
+        mismatchCnt |= (uint32_t)pllRegCfg[126U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x20U);
+        mismatchCnt |= (uint32_t)pllRegCfg[127U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x24U);
+        mismatchCnt |= (uint32_t)pllRegCfg[128U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x30U);
+        mismatchCnt |= (uint32_t)pllRegCfg[129U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x34U);
+        mismatchCnt |= (uint32_t)pllRegCfg[130U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x38U);
+        mismatchCnt |= (uint32_t)pllRegCfg[131U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x40U);
+        mismatchCnt |= (uint32_t)pllRegCfg[132U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x44U);
+        mismatchCnt |= (uint32_t)pllRegCfg[133U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x60U);
+        mismatchCnt |= (uint32_t)pllRegCfg[134U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x64U);
+        mismatchCnt |= (uint32_t)pllRegCfg[135U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x80U);
+        /* PLL 9: SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) */
+        mismatchCnt |= (uint32_t)pllRegCfg[136U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x00U);
+        mismatchCnt |= (uint32_t)pllRegCfg[137U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x08U);
+        mismatchCnt |= (uint32_t)pllRegCfg[138U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x20U);
+        mismatchCnt |= (uint32_t)pllRegCfg[139U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x24U);
+        mismatchCnt |= (uint32_t)pllRegCfg[140U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x30U);
+        mismatchCnt |= (uint32_t)pllRegCfg[141U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x34U);
+        mismatchCnt |= (uint32_t)pllRegCfg[142U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x38U);
+        mismatchCnt |= (uint32_t)pllRegCfg[143U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x40U);
+        mismatchCnt |= (uint32_t)pllRegCfg[144U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x44U);
+        mismatchCnt |= (uint32_t)pllRegCfg[145U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x60U);
+        mismatchCnt |= (uint32_t)pllRegCfg[146U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x64U);
+        mismatchCnt |= (uint32_t)pllRegCfg[147U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x80U);
+        mismatchCnt |= (uint32_t)pllRegCfg[148U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x84U);
+        mismatchCnt |= (uint32_t)pllRegCfg[149U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x88U);
+        mismatchCnt |= (uint32_t)pllRegCfg[150U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x8CU);
+        mismatchCnt |= (uint32_t)pllRegCfg[151U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x90U);
+        mismatchCnt |= (uint32_t)pllRegCfg[152U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x94U);
+        mismatchCnt |= (uint32_t)pllRegCfg[153U] ^ (uint32_t)CSL_REG32_RD(SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x98U);
+
+        if (mismatchCnt != 0U)
+        {
+            status = SAFETY_CHECKERS_REG_DATA_MISMATCH;
+        }
+    }
+
+    return status;
+}
@@ -265,6 +265,224 @@ static SafetyCheckers_PmPscData gSafetyCheckers_PmPscData[] =
        {SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS,        SAFETY_CHECKERS_PM_PD_STAT_NUM,      SAFETY_CHECKERS_PM_MD_STAT_NUM},
 };
 
+/* Start of generated PM flat address tables, see utils/safety_checkers_pm_flat_gen.py */
+
+/** \brief Number of registers of the flat PLL address table */
+#define SAFETY_CHECKERS_PM_PLL_FLAT_NUM                           (192U)
+/** \brief Number of registers of the flat PSC address table */
+#define SAFETY_CHECKERS_PM_PSC_FLAT_NUM                           (131U)
+
+/**
+ *
+ * \brief Address of every PLL register in the gSafetyCheckers_PmPllData read order
+ *
+ */
+static const uint32_t gSafetyCheckers_PmPllRegAddr[SAFETY_CHECKERS_PM_PLL_FLAT_NUM] =
+{
+    /* PLL 0: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) */
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x00U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x08U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x20U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x24U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x30U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x34U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x38U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x40U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x44U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x60U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x64U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x80U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x84U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x88U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x8CU), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x90U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x94U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x98U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0x9CU), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0xA0U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(0) + 0xA4U),
+    /* PLL 1: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) */
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x00U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x08U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x20U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x24U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x30U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x34U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x38U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x40U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x44U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x60U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x64U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x80U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x84U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x88U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x8CU), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x90U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x94U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(1) + 0x98U),
+    /* PLL 2: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) */
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x00U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x08U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x20U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x24U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x30U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x34U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x38U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x40U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x44U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x60U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x64U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x80U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x84U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x88U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x8CU), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x90U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x94U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x98U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0x9CU), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0xA0U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(2) + 0xA4U),
+    /* PLL 3: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) */
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x00U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x08U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x20U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x24U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x30U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x34U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x38U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x40U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x44U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x60U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x64U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x80U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x84U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(5) + 0x88U),
+    /* PLL 4: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(6) */
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(6) + 0x00U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(6) + 0x08U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(6) + 0x20U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(6) + 0x24U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(6) + 0x30U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(6) + 0x34U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(6) + 0x38U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(6) + 0x40U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(6) + 0x44U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(6) + 0x60U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(6) + 0x64U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(6) + 0x80U),
+    /* PLL 5: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) */
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x00U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x08U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x20U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x24U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x30U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x34U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x38U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x40U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x44U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x60U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x64U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x80U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(7) + 0x84U),
+    /* PLL 6: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) */
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x00U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x08U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x20U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x24U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x30U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x34U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x38U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x40U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x44U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x60U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x64U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(8) + 0x80U),
+    /* PLL 7: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) */
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x00U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x08U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x20U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x24U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x30U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x34U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x38U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x40U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x44U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x60U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x64U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(12) + 0x80U),
+    /* PLL 8: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) */
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x00U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x08U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x20U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x24U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x30U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x34U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x38U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x40U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x44U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x60U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x64U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x80U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x84U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x88U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(15) + 0x8CU),
+    /* PLL 9: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(16) */
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(16) + 0x00U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(16) + 0x08U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(16) + 0x20U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(16) + 0x24U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(16) + 0x30U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(16) + 0x34U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(16) + 0x38U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(16) + 0x40U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(16) + 0x44U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(16) + 0x60U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(16) + 0x64U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(16) + 0x80U),
+    /* PLL 10: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) */
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x00U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x08U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x20U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x24U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x30U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x34U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x38U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x40U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x44U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x60U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x64U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(17) + 0x80U),
+    /* PLL 11: SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(18) */
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(18) + 0x00U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(18) + 0x08U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(18) + 0x20U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(18) + 0x24U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(18) + 0x30U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(18) + 0x34U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(18) + 0x38U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(18) + 0x40U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(18) + 0x44U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(18) + 0x60U),
+    (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(18) + 0x64U), (SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(18) + 0x80U),
+    /* PLL 12: SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) */
+    (SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x00U), (SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x08U),
+    (SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x20U), (SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x24U),
+    (SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x30U), (SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x34U),
+    (SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x38U), (SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x40U),
+    (SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x44U), (SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x60U),
+    (SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x64U), (SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x80U),
+    (SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x84U), (SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x88U),
+    (SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x8CU), (SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x90U),
+    (SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x94U), (SAFETY_CHECKERS_PM_MCU_PLL_BASE_ADDRESS(0) + 0x98U),
+};
+
+/**
+ *
+ * \brief Index of the first register of each PLL in gSafetyCheckers_PmPllRegAddr.
+ *        The last entry is SAFETY_CHECKERS_PM_PLL_FLAT_NUM.
+ *
+ */
+static const uint32_t gSafetyCheckers_PmPllRegIndex[14U] =
+{
+    0U, 21U, 39U, 60U, 74U, 86U, 99U, 111U,
+    123U, 138U, 150U, 162U, 174U, 192U,
+};
+
+/**
+ *
+ * \brief Address of every PSC register in the gSafetyCheckers_PmPscData read order
+ *
+ */
+static const uint32_t gSafetyCheckers_PmPscRegAddr[SAFETY_CHECKERS_PM_PSC_FLAT_NUM] =
+{
+    /* PSC 0: SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS */
+    (SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x200U), (SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x204U),
+    (SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x800U), (SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x804U),
+    (SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x808U), (SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x80CU),
+    (SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x810U), (SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x814U),
+    (SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x818U), (SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x81CU),
+    (SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x820U), (SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x824U),
+    (SAFETY_CHECKERS_PM_WKUP_PSC_BASE_ADDRESS + 0x828U),
+    /* PSC 1: SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS */
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x200U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x204U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x208U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x20CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x210U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x214U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x218U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x21CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x220U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x224U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x228U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x22CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x230U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x234U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x238U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x23CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x240U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x244U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x248U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x24CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x250U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x254U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x800U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x804U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x808U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x80CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x810U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x814U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x818U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x81CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x820U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x824U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x828U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x82CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x830U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x834U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x838U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x83CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x840U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x844U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x848U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x84CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x850U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x854U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x858U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x85CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x860U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x864U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x868U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x86CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x870U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x874U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x878U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x87CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x880U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x884U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x888U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x88CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x890U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x894U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x898U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x89CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8A0U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8A4U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8A8U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8ACU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8B0U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8B4U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8B8U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8BCU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8C0U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8C4U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8C8U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8CCU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8D0U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8D4U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8D8U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8DCU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8E0U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8E4U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8E8U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8ECU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8F0U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8F4U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8F8U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x8FCU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x900U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x904U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x908U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x90CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x910U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x914U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x918U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x91CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x920U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x924U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x928U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x92CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x930U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x934U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x938U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x93CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x940U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x944U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x948U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x94CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x950U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x954U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x958U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x95CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x960U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x964U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x968U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x96CU),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x970U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x974U),
+    (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x978U), (SAFETY_CHECKERS_PM_PSC_BASE_ADDRESS + 0x97CU),
+};
+
+/* End of generated PM flat address tables */
+
 /** 
  *    
  * \brief Structure defines RM module register base address and the total length of registers
@@ -83,6 +83,16 @@ extern "C" {
 #define SAFETY_CHECKERS_PM_PSC_PD_STAT_OFFSET                    (0x200U)
 /** \brief PSC Module Domain(MD) STAT register offset */
 #define SAFETY_CHECKERS_PM_PSC_MD_STAT_OFFSET                    (0x800U)
+/** \brief PSC PD STAT power state field and its powered off value */
+#define SAFETY_CHECKERS_PM_PSC_PD_STAT_STATE_MASK                (0x1FU)
+#define SAFETY_CHECKERS_PM_PSC_PD_STAT_STATE_OFF                 (0x0U)
+/** \brief Highest settled PD STAT power state (on), the higher states are transitions */
+#define SAFETY_CHECKERS_PM_PSC_PD_STAT_STATE_ON                  (0x1U)
+/** \brief PSC MD STAT module state field and its highest settled value (enable) */
+#define SAFETY_CHECKERS_PM_PSC_MD_STAT_STATE_MASK                (0x3FU)
+#define SAFETY_CHECKERS_PM_PSC_MD_STAT_STATE_ENABLE              (0x3U)
+/** \brief PSC PTSTAT register offset, one GO status bit per PD and one register per 32 PDs */
+#define SAFETY_CHECKERS_PM_PSC_PTSTAT_OFFSET                     (0x128U)
 
 /** \brief Each PLL base addresses */
 #define SAFETY_CHECKERS_PM_PLL_BASE_ADDRESS(i)                   (SAFETY_CHECKERS_PM_PLL_CFG_BASE_ADDRESS + (0x1000U * (uint32_t)i))
@@ -92,6 +102,29 @@ extern "C" {
 #define SAFETY_CHECKERS_PM_KICK_LOCK                             (0x00000000U)
 #define SAFETY_CHECKERS_PM_LOCK_KEY0_OFFSET                      (0x10U)
 #define SAFETY_CHECKERS_PM_LOCK_KEY1_OFFSET                      (0x14U)
+/** \brief LOCKKEY0 status bit, set while the PLL registers are unlocked */
+#define SAFETY_CHECKERS_PM_LOCK_KEY0_UNLOCKED                    (0x1U)
+
+/** \brief PLL_16FFT register offsets used to decode the PLL output frequencies */
+#define SAFETY_CHECKERS_PM_PLL_CTRL_OFFSET                       (0x20U)
+#define SAFETY_CHECKERS_PM_PLL_STAT_OFFSET                       (0x24U)
+#define SAFETY_CHECKERS_PM_PLL_FREQ_CTRL0_OFFSET                 (0x30U)
+#define SAFETY_CHECKERS_PM_PLL_FREQ_CTRL1_OFFSET                 (0x34U)
+#define SAFETY_CHECKERS_PM_PLL_DIV_CTRL_OFFSET                   (0x38U)
+#define SAFETY_CHECKERS_PM_PLL_HSDIV_CTRL_OFFSET                 (0x80U)
+
+/** \brief PLL_16FFT register fields used to decode the PLL output frequencies */
+#define SAFETY_CHECKERS_PM_PLL_CTRL_BYPASS_EN                    (0x80000000U)
+#define SAFETY_CHECKERS_PM_PLL_STAT_LOCK                         (0x1U)
+#define SAFETY_CHECKERS_PM_PLL_FB_DIV_INT_MASK                   (0xFFFU)
+#define SAFETY_CHECKERS_PM_PLL_FB_DIV_FRAC_MASK                  (0xFFFFFFU)
+#define SAFETY_CHECKERS_PM_PLL_FB_DIV_FRAC_BITS                  (24U)
+#define SAFETY_CHECKERS_PM_PLL_REF_DIV_MASK                      (0x3FU)
+#define SAFETY_CHECKERS_PM_PLL_POST_DIV1_SHIFT                   (16U)
+#define SAFETY_CHECKERS_PM_PLL_POST_DIV2_SHIFT                   (24U)
+#define SAFETY_CHECKERS_PM_PLL_POST_DIV_MASK                     (0x7U)
+#define SAFETY_CHECKERS_PM_PLL_HSDIV_DIV_MASK                    (0x7FU)
+#define SAFETY_CHECKERS_PM_PLL_HSDIV_CLKOUT_EN                   (0x8000U)
 
 /** @} */
 
@@ -80,6 +80,12 @@ extern "C" {
 #define SAFETY_CHECKERS_RM_REG_HEX100		(0X100U)
 #define SAFETY_CHECKERS_RM_REG_HEX1000		(0X1000U)
 
+/**
+ * \brief  Total register signature size for RM.
+ *         One signature is stored for each entry of gSafetyCheckers_RmRegData.
+ */
+#define SAFETY_CHECKERS_RM_REGSIG_SIZE      ((uint32_t)(sizeof(gSafetyCheckers_RmRegData) / sizeof(SafetyCheckers_RmRegData)))
+
 /** @} */
 
 /* ========================================================================== */
@@ -0,0 +1,166 @@
+'''
+  Copyright (C) 2024 Texas Instruments Incorporated
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+
+    Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the
+    distribution.
+
+    Neither the name of Texas Instruments Incorporated nor the names of
+    its contributors may be used to endorse or promote products derived
+    from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+'''
+
+############################ Imports ############################
+
+import argparse
+import mmap
+import struct
+import sys
+
+
+########################### Definitions ###########################
+
+# Layout of SafetyCheckers_GoldenHdr and SafetyCheckers_GoldenSection (little endian)
+GOLDEN_MAGIC = 0x49474353
+GOLDEN_FORMAT_VERSION = 1
+GOLDEN_SEC_TYPE_MAX = 5
+GOLDEN_HDR_FMT = "<10IQ5I5IQ"
+GOLDEN_HDR_SIZE = struct.calcsize(GOLDEN_HDR_FMT)
+GOLDEN_HDR_SIG_SIZE = GOLDEN_HDR_SIZE - 8
+GOLDEN_SEC_FMT = "<4IQ"
+GOLDEN_SEC_SIZE = struct.calcsize(GOLDEN_SEC_FMT)
+
+GOLDEN_SOC_NAMES = {1: "am62x", 2: "am62ax", 3: "am62px", 4: "j722s",
+                    5: "j7200", 6: "j721e", 7: "j721s2", 8: "j784s4"}
+GOLDEN_SEC_TYPE_NAMES = ["PSC", "PLL", "RM", "TIFS_FWL", "CSIRX"]
+
+# Signature used by the library: CRC-64/XZ polynomial, all ones seed, no final xor
+SIG_POLY = 0xC96C5795D7870F42
+SIG_SEED = 0xFFFFFFFFFFFFFFFF
+
+
+####################### Function Definiton #######################
+
+def make_sig_table():
+    table = []
+    for byte in range(256):
+        crc = byte
+        for _ in range(8):
+            if crc & 1:
+                crc = (crc >> 1) ^ SIG_POLY
+            else:
+                crc >>= 1
+        table.append(crc)
+    return table
+
+SIG_TABLE = make_sig_table()
+
+def sig_update(sig, data):
+    # data is a memoryview into the mapped image, the bytes are not copied
+    for byte in data:
+        sig = SIG_TABLE[(sig ^ byte) & 0xFF] ^ (sig >> 8)
+    return sig
+
+def parse_golden_image(image, verbose):
+    errors = 0
+
+    if len(image) < GOLDEN_HDR_SIZE:
+        print("Image too small for the golden image header")
+        return 1
+
+    hdr = struct.unpack_from(GOLDEN_HDR_FMT, image, 0)
+    (magic, format_version, soc_id, core_id, lib_version, image_size, image_capacity,
+     num_sections, max_sections, _) = hdr[0:10]
+    table_sig = hdr[10]
+    type_first = hdr[11:16]
+    type_count = hdr[16:21]
+    hdr_sig = hdr[21]
+
+    if magic != GOLDEN_MAGIC or format_version != GOLDEN_FORMAT_VERSION:
+        print("Not a golden image or unsupported format version (magic 0x%08X, version %d)" % (magic, format_version))
+        return 1
+
+    print("SoC            : %s" % GOLDEN_SOC_NAMES.get(soc_id, "unknown (%d)" % soc_id))
+    print("Core id        : 0x%X" % core_id)
+    print("Library version: %d.%d" % (lib_version >> 16, lib_version & 0xFFFF))
+    print("Image size     : %d of %d bytes" % (image_size, image_capacity))
+    print("Sections       : %d of %d" % (num_sections, max_sections))
+    print("Table signature: 0x%016X" % table_sig)
+    for sec_type in range(GOLDEN_SEC_TYPE_MAX):
+        print("  %-8s : %5d sections from directory entry %d" % (GOLDEN_SEC_TYPE_NAMES[sec_type],
+              type_count[sec_type], type_first[sec_type]))
+
+    dir_end = GOLDEN_HDR_SIZE + (max_sections * GOLDEN_SEC_SIZE)
+    if image_size > len(image) or dir_end > image_size or num_sections > max_sections:
+        print("Image is truncated or the directory is out of range")
+        return 1
+
+    # Header signature covers the header up to hdrSig and the directory entries in use
+    sig = sig_update(SIG_SEED, image[0:GOLDEN_HDR_SIG_SIZE])
+    sig = sig_update(sig, image[GOLDEN_HDR_SIZE:GOLDEN_HDR_SIZE + (num_sections * GOLDEN_SEC_SIZE)])
+    if sig != hdr_sig:
+        print("Header signature mismatch: 0x%016X, expected 0x%016X" % (sig, hdr_sig))
+        errors += 1
+
+    for sec in range(num_sections):
+        sec_type, index, offset, count, sec_sig = struct.unpack_from(GOLDEN_SEC_FMT, image,
+                                                                      GOLDEN_HDR_SIZE + (sec * GOLDEN_SEC_SIZE))
+        name = GOLDEN_SEC_TYPE_NAMES[sec_type] if sec_type < GOLDEN_SEC_TYPE_MAX else "?"
+        if offset < dir_end or offset + (count * 4) > image_size:
+            print("Section %d (%s %d) is out of range" % (sec, name, index))
+            errors += 1
+            continue
+
+        sig = sig_update(SIG_SEED, image[offset:offset + (count * 4)])
+        result = "OK" if sig == sec_sig else "SIGNATURE MISMATCH"
+        if sig != sec_sig:
+            errors += 1
+        if verbose or sig != sec_sig:
+            print("  [%4d] %-8s %4d : offset 0x%08X, %6d words, sig 0x%016X %s" % (sec, name, index, offset,
+                  count, sec_sig, result))
+
+    return errors
+
+
+############################ Main ############################
+
+def main(argv):
+    parser = argparse.ArgumentParser(description="Check a golden image stored by the application")
+    parser.add_argument("input_filename", help="Path to the golden image stored by the application")
+    parser.add_argument("-v", "--verbose", action="store_true", help="Print every directory entry")
+    args = parser.parse_args(argv)
+
+    # Map the image read only and parse it in place
+    with open(args.input_filename, "rb") as input_file:
+        with mmap.mmap(input_file.fileno(), 0, access=mmap.ACCESS_READ) as mapped:
+            image = memoryview(mapped)
+            errors = parse_golden_image(image, args.verbose)
+            image.release()
+
+    if errors != 0:
+        print("%d error(s) found" % errors)
+        exit(1)
+    print("Golden image is intact")
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
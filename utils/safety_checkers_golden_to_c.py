@@ -0,0 +1,160 @@
+'''
+  Copyright (C) 2024 Texas Instruments Incorporated
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+
+    Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the
+    distribution.
+
+    Neither the name of Texas Instruments Incorporated nor the names of
+    its contributors may be used to endorse or promote products derived
+    from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+'''
+
+############################ Imports ############################
+
+import argparse
+import mmap
+import os
+import re
+import struct
+import sys
+from datetime import datetime
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from safety_checkers_golden_parse import parse_golden_image, GOLDEN_HDR_FMT
+
+
+####################### Function Definiton #######################
+
+def print_golden_array(output_filename, array_name, image, image_size, command):
+    guard = re.sub(r"[^A-Z0-9]", "_", os.path.basename(output_filename).upper()) + "_"
+    num_words = image_size // 4
+
+    with open(output_filename, "w") as output_file:
+        # Write copyright to file
+        writeBanner(output_file)
+
+        # Write auto-generated comment along with timestamp
+        output_file.write("\n/* \n * Auto-generated golden image using the command '" + command + "' \n * on " + datetime.now().strftime("%d/%m/%Y %H:%M:%S") + " \n */\n\n")
+
+        # Write section headers
+        output_file.write("#ifndef " + guard + "\n")
+        output_file.write("#define " + guard + "\n\n")
+        output_file.write("/* ========================================================================== */\n")
+        output_file.write("/*                             Include Files                                  */\n")
+        output_file.write("/* ========================================================================== */\n\n")
+        output_file.write("#include <stdint.h>\n\n")
+        output_file.write("#ifdef __cplusplus\n")
+        output_file.write("extern \"C\" {\n")
+        output_file.write("#endif\n\n")
+        output_file.write("/* ========================================================================== */\n")
+        output_file.write("/*                           Macros & Typedefs                                */\n")
+        output_file.write("/* ========================================================================== */\n\n")
+        output_file.write("/* Size of the golden image in 32-bit words */\n")
+        output_file.write("#define " + array_name.upper() + "_SIZE\t(" + str(num_words) + "U)\n\n")
+        output_file.write("/* ========================================================================== */\n")
+        output_file.write("/*                         Structure Declarations                             */\n")
+        output_file.write("/* ========================================================================== */\n\n")
+        output_file.write("/* None */\n\n")
+        output_file.write("/* ========================================================================== */\n")
+        output_file.write("/*                            Global Variables                                */\n")
+        output_file.write("/* ========================================================================== */\n\n")
+
+        output_file.write("/* Golden image kept in read only (XIP) memory and verified in place with\n")
+        output_file.write(" * SafetyCheckers_goldenValidate and SafetyCheckers_goldenVerify */\n")
+        output_file.write("const uint32_t " + array_name + "[" + array_name.upper() + "_SIZE]\n")
+        output_file.write("    __attribute__((aligned(8), section(\".rodata.safety_checkers_golden\"))) = {\n")
+
+        # Eight words per line, little endian as stored by the target
+        for word in range(0, num_words, 8):
+            line_words = struct.unpack_from("<%dI" % min(8, num_words - word), image, word * 4)
+            output_file.write("\t" + ", ".join("0x%08XU" % value for value in line_words) + ",\n")
+        output_file.seek(output_file.tell()-2)
+        output_file.truncate()
+        output_file.write("\n};")
+
+        output_file.write("\n\n#ifdef __cplusplus\n")
+        output_file.write("}\n")
+        output_file.write("#endif\n\n")
+        output_file.write("#endif  /* #ifndef " + guard + " */\n")
+
+def writeBanner(file):
+    # TI copyright
+    file.write('/*\n')
+    file.write(' * Copyright (C) 2024 Texas Instruments Incorporated\n')
+    file.write(' *  \n')
+    file.write(' *  Redistribution and use in source and binary forms, with or without \n')
+    file.write(' *  modification, are permitted provided that the following conditions\n')
+    file.write(' *  are met:\n')
+    file.write(' *\n')
+    file.write(' *    Redistributions of source code must retain the above copyright\n')
+    file.write(' *    notice, this list of conditions and the following disclaimer.\n')
+    file.write(' *\n')
+    file.write(' *    Redistributions in binary form must reproduce the above copyright\n')
+    file.write(' *    notice, this list of conditions and the following disclaimer in the\n')
+    file.write(' *    documentation and/or other materials provided with the\n')
+    file.write(' *    distribution.\n')
+    file.write(' *\n')
+    file.write(' *    Neither the name of Texas Instruments Incorporated nor the names of\n')
+    file.write(' *    its contributors may be used to endorse or promote products derived\n')
+    file.write(' *    from this software without specific prior written permission.\n')
+    file.write(' *\n')
+    file.write(' *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS \n')
+    file.write(' *  \"AS IS\" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT \n')
+    file.write(' *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR \n')
+    file.write(' *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT \n')
+    file.write(' *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, \n')
+    file.write(' *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT \n')
+    file.write(' *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,\n')
+    file.write(' *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY\n')
+    file.write(' *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT\n')
+    file.write(' *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE\n')
+    file.write(' *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.\n')
+    file.write(' */\n')
+
+
+############################ Main ############################
+
+def main(argv):
+    parser = argparse.ArgumentParser(description="Convert a golden image dumped from the target into a const C array")
+    parser.add_argument("input_filename", help="Golden image dumped from the target (first imageSize bytes)")
+    parser.add_argument("output_filename", help="Path to store the output .h file")
+    parser.add_argument("array_name", help="Name of the const golden image array")
+    args = parser.parse_args(argv)
+    command = "python safety_checkers_golden_to_c.py " + " ".join(argv)
+
+    # Map the image read only, check it and emit it without an intermediate copy
+    with open(args.input_filename, "rb") as input_file:
+        with mmap.mmap(input_file.fileno(), 0, access=mmap.ACCESS_READ) as mapped:
+            image = memoryview(mapped)
+            errors = parse_golden_image(image, False)
+            if errors != 0:
+                image.release()
+                print("Golden image is not intact, no output written")
+                exit(1)
+            image_size = struct.unpack_from(GOLDEN_HDR_FMT, image, 0)[5]
+            print_golden_array(args.output_filename, args.array_name, image, image_size, command)
+            image.release()
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
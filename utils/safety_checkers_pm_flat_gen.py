@@ -0,0 +1,215 @@
+'''
+  Copyright (C) 2024 Texas Instruments Incorporated
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+
+    Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the
+    distribution.
+
+    Neither the name of Texas Instruments Incorporated nor the names of
+    its contributors may be used to endorse or promote products derived
+    from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+'''
+
+############################ Imports ############################
+
+import argparse
+import os
+import re
+import sys
+
+
+############################ Globals ############################
+
+GEN_START = "/* Start of generated PM flat address tables, see utils/safety_checkers_pm_flat_gen.py */"
+GEN_END = "/* End of generated PM flat address tables */"
+
+PLL_OFFSET_FILE = "safety_checkers_pm_soc.h"
+SOC_FILE = "safety_checkers_soc.h"
+
+PSC_PD_STAT_OFFSET = 0x200
+PSC_MD_STAT_OFFSET = 0x800
+
+ENTRIES_PER_LINE = 2
+
+
+####################### Function Definiton #######################
+
+def parse_literal(text):
+    # Integer literal of a C macro, e.g. (0xA4U) or (285U)
+    match = re.fullmatch(r"\(?\s*(0[xX][0-9A-Fa-f]+|\d+)[uU]?\s*\)?", text.strip())
+    if match is None:
+        return None
+    return int(match.group(1), 0)
+
+def parse_macros(text):
+    macros = {}
+    for name, value in re.findall(r"^\s*#define\s+(\w+)\s+(\([^\n]*?\)|\S+)\s*$", text, re.M):
+        literal = parse_literal(value)
+        if literal is not None:
+            macros[name] = literal
+    return macros
+
+def parse_table(text, name):
+    # Body of a 'static <type> name[] = { ... };' table
+    match = re.search(r"\b" + name + r"\s*\[\]\s*=\s*\{(.*?)\n\};", text, re.S)
+    if match is None:
+        raise ValueError(name + " not found")
+    return match.group(1)
+
+def parse_pll_offsets(text):
+    offsets = {}
+    for name, body in re.findall(r"static\s+uint32_t\s+(gSafetyCheckers_PmPllRegOffset\d+)\s*\[\]\s*=\s*\{([^}]*)\}", text):
+        offsets[name] = [parse_literal(value) for value in body.split(",") if value.strip() != ""]
+    return offsets
+
+def resolve(macros, value):
+    literal = parse_literal(value)
+    if literal is None:
+        literal = macros[value]
+    return literal
+
+def build_tables(soc_text, pll_offsets):
+    macros = parse_macros(soc_text)
+
+    # PLL registers: every offset before the one equal to the length of the PLL
+    pll_regs = []
+    pll_index = [0]
+    for base, offset_name, length in re.findall(r"\{\s*(\w+\([^)]*\))\s*,\s*(\w+)\s*,\s*(\w+)\s*\}",
+                                                parse_table(soc_text, "gSafetyCheckers_PmPllData")):
+        offsets = pll_offsets[offset_name]
+        length = resolve(macros, length)
+        if length not in offsets:
+            raise ValueError("PLL " + base + ": length 0x%X is not in %s" % (length, offset_name))
+        pll_regs.append((base, offsets[:offsets.index(length)]))
+        pll_index.append(pll_index[-1] + len(pll_regs[-1][1]))
+
+    # PSC registers: the PD stat registers of a PSC followed by its MD stat registers
+    psc_regs = []
+    for base, pd_stat, md_stat in re.findall(r"\{\s*(\w+)\s*,\s*(\w+)\s*,\s*(\w+)\s*\}",
+                                             parse_table(soc_text, "gSafetyCheckers_PmPscData")):
+        offsets = [PSC_PD_STAT_OFFSET + (4 * pd) for pd in range(resolve(macros, pd_stat))]
+        offsets += [PSC_MD_STAT_OFFSET + (4 * md) for md in range(resolve(macros, md_stat))]
+        psc_regs.append((base, offsets))
+
+    # The generated counts shall match the register dump sizes of the SoC header
+    for dump_size, regs in (("SAFETY_CHECKERS_PM_PLL_REGDUMP_SIZE", pll_regs),
+                            ("SAFETY_CHECKERS_PM_PSC_REGDUMP_SIZE", psc_regs)):
+        count = sum(len(offsets) for _, offsets in regs)
+        if (dump_size in macros) and (macros[dump_size] != count):
+            raise ValueError("%s is %d, the table holds %d registers" % (dump_size, macros[dump_size], count))
+
+    return pll_regs, pll_index, psc_regs
+
+def print_addr_table(lines, name, size_macro, regs, label):
+    lines.append("static const uint32_t " + name + "[" + size_macro + "] =")
+    lines.append("{")
+    for index, (base, offsets) in enumerate(regs):
+        lines.append("    /* " + label + " " + str(index) + ": " + base + " */")
+        entries = ["(" + base + " + 0x%02XU)" % offset for offset in offsets]
+        for first in range(0, len(entries), ENTRIES_PER_LINE):
+            lines.append("    " + ", ".join(entries[first:first + ENTRIES_PER_LINE]) + ",")
+    lines.append("};")
+
+def print_flat_tables(pll_regs, pll_index, psc_regs):
+    lines = [GEN_START, ""]
+    lines.append("/** \\brief Number of registers of the flat PLL address table */")
+    lines.append("#define SAFETY_CHECKERS_PM_PLL_FLAT_NUM                           (%dU)" % pll_index[-1])
+    lines.append("/** \\brief Number of registers of the flat PSC address table */")
+    lines.append("#define SAFETY_CHECKERS_PM_PSC_FLAT_NUM                           (%dU)" % sum(len(o) for _, o in psc_regs))
+    lines.append("")
+    lines.append("/**")
+    lines.append(" *")
+    lines.append(" * \\brief Address of every PLL register in the gSafetyCheckers_PmPllData read order")
+    lines.append(" *")
+    lines.append(" */")
+    print_addr_table(lines, "gSafetyCheckers_PmPllRegAddr", "SAFETY_CHECKERS_PM_PLL_FLAT_NUM", pll_regs, "PLL")
+    lines.append("")
+    lines.append("/**")
+    lines.append(" *")
+    lines.append(" * \\brief Index of the first register of each PLL in gSafetyCheckers_PmPllRegAddr.")
+    lines.append(" *        The last entry is SAFETY_CHECKERS_PM_PLL_FLAT_NUM.")
+    lines.append(" *")
+    lines.append(" */")
+    lines.append("static const uint32_t gSafetyCheckers_PmPllRegIndex[%dU] =" % len(pll_index))
+    lines.append("{")
+    for first in range(0, len(pll_index), 8):
+        lines.append("    " + ", ".join("%dU" % index for index in pll_index[first:first + 8]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("/**")
+    lines.append(" *")
+    lines.append(" * \\brief Address of every PSC register in the gSafetyCheckers_PmPscData read order")
+    lines.append(" *")
+    lines.append(" */")
+    print_addr_table(lines, "gSafetyCheckers_PmPscRegAddr", "SAFETY_CHECKERS_PM_PSC_FLAT_NUM", psc_regs, "PSC")
+    lines.append("")
+    lines.append(GEN_END)
+    return "\n".join(lines) + "\n"
+
+def update_soc_header(soc_file, pll_offsets, check_only):
+    with open(soc_file, "r") as input_file:
+        soc_text = input_file.read()
+
+    pll_regs, pll_index, psc_regs = build_tables(soc_text, pll_offsets)
+    block = print_flat_tables(pll_regs, pll_index, psc_regs)
+
+    if GEN_START in soc_text:
+        start = soc_text.index(GEN_START)
+        end = soc_text.index(GEN_END) + len(GEN_END) + 1
+        new_text = soc_text[:start] + block + soc_text[end:]
+    else:
+        # First run: place the tables right after the PSC table they are built from
+        table = re.search(r"gSafetyCheckers_PmPscData\s*\[\]\s*=\s*\{.*?\n\};\n", soc_text, re.S)
+        new_text = soc_text[:table.end()] + "\n" + block + soc_text[table.end():]
+
+    if new_text == soc_text:
+        return 0
+    if check_only:
+        print(soc_file + ": flat address tables are out of date")
+        return 1
+    with open(soc_file, "w") as output_file:
+        output_file.write(new_text)
+    print(soc_file + ": %d PLL and %d PSC registers" % (pll_index[-1], sum(len(o) for _, o in psc_regs)))
+    return 0
+
+
+############################ Main ############################
+
+def main(argv):
+    parser = argparse.ArgumentParser(description="Generate the flat PLL/PSC address tables of each SoC header")
+    parser.add_argument("soc_dir", help="src/soc directory holding safety_checkers_pm_soc.h and one directory per SoC")
+    parser.add_argument("--check", action="store_true", help="Only report the SoC headers whose tables are out of date")
+    args = parser.parse_args(argv)
+
+    with open(os.path.join(args.soc_dir, PLL_OFFSET_FILE), "r") as input_file:
+        pll_offsets = parse_pll_offsets(input_file.read())
+
+    errors = 0
+    for soc in sorted(os.listdir(args.soc_dir)):
+        soc_file = os.path.join(args.soc_dir, soc, SOC_FILE)
+        if os.path.isfile(soc_file):
+            errors += update_soc_header(soc_file, pll_offsets, args.check)
+    exit(1 if errors != 0 else 0)
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
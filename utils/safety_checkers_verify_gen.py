@@ -0,0 +1,242 @@
+'''
+  Copyright (C) 2024 Texas Instruments Incorporated
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+
+    Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the
+    distribution.
+
+    Neither the name of Texas Instruments Incorporated nor the names of
+    its contributors may be used to endorse or promote products derived
+    from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+'''
+
+
+############################ Imports ############################
+
+import argparse
+import os
+import re
+import sys
+
+from safety_checkers_pm_flat_gen import build_tables, parse_literal, parse_macros, parse_pll_offsets, parse_table, resolve
+
+
+############################ Globals ############################
+
+PLL_OFFSET_FILE = "safety_checkers_pm_soc.h"
+RM_STRIDE_FILE = "safety_checkers_rm_soc.h"
+SOC_FILE = "safety_checkers_soc.h"
+VERIFY_FILE = "safety_checkers_verify_soc.c"
+VERIFY_RM_FILE = "safety_checkers_verify_rm_soc.c"
+
+LICENSE = '''/*
+ *  Copyright (C) 2024 Texas Instruments Incorporated
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+'''
+
+
+####################### Function Definiton #######################
+
+def banner(lines, title):
+    lines.append("/* ========================================================================== */")
+    lines.append("/*" + title.center(76) + "*/")
+    lines.append("/* ========================================================================== */")
+    lines.append("")
+
+def build_rm_regs(soc_text, stride_text):
+    # RM registers: module -> register -> instance, as read by SafetyCheckers_rmGetRegCfg
+    macros = parse_macros(stride_text)
+    macros.update(parse_macros(soc_text))
+    rm_regs = []
+    for base, reg_num, reg_array_len, stride, offsets in re.findall(
+            r"\{\s*(\w+)\s*,\s*(\w+)\s*,\s*(\w+)\s*,\s*(\w+)\s*,\s*\{([^}]*)\}\s*\}",
+            parse_table(soc_text, "gSafetyCheckers_RmRegData")):
+        offsets = [parse_literal(value) for value in offsets.split(",") if value.strip() != ""]
+        stride = resolve(macros, stride)
+        module = []
+        for offset in offsets[:resolve(macros, reg_num)]:
+            module += [offset + (stride * instance) for instance in range(resolve(macros, reg_array_len))]
+        rm_regs.append((base, module))
+
+    count = sum(len(offsets) for _, offsets in rm_regs)
+    if ("SAFETY_CHECKERS_RM_REGDUMP_SIZE" in macros) and (macros["SAFETY_CHECKERS_RM_REGDUMP_SIZE"] != count):
+        raise ValueError("SAFETY_CHECKERS_RM_REGDUMP_SIZE is %d, the table holds %d registers" %
+                         (macros["SAFETY_CHECKERS_RM_REGDUMP_SIZE"], count))
+    return rm_regs
+
+def print_verify_fxn(lines, name, cfg, size_macro, regs, label):
+    lines.append("int32_t " + name + "(const uintptr_t *" + cfg + ", uint32_t size)")
+    lines.append("{")
+    lines.append("    uint32_t mismatchCnt = 0U;")
+    lines.append("    int32_t  status = SAFETY_CHECKERS_SOK;")
+    lines.append("")
+    lines.append("    if (" + cfg + " == NULL)")
+    lines.append("    {")
+    lines.append("        status = SAFETY_CHECKERS_FAIL;")
+    lines.append("    }")
+    lines.append("")
+    lines.append("    if ((status == SAFETY_CHECKERS_SOK) && (" + size_macro + " > size))")
+    lines.append("    {")
+    lines.append("        status = SAFETY_CHECKERS_INSUFFICIENT_BUFF;")
+    lines.append("    }")
+    lines.append("")
+    lines.append("    if (status == SAFETY_CHECKERS_SOK)")
+    lines.append("    {")
+    index = 0
+    for number, (base, offsets) in enumerate(regs):
+        lines.append("        /* " + label + " " + str(number) + ": " + base + " */")
+        for offset in offsets:
+            lines.append("        mismatchCnt |= (uint32_t)%s[%dU] ^ (uint32_t)CSL_REG32_RD(%s + 0x%02XU);" %
+                         (cfg, index, base, offset))
+            index += 1
+    lines.append("")
+    lines.append("        if (mismatchCnt != 0U)")
+    lines.append("        {")
+    lines.append("            status = SAFETY_CHECKERS_REG_DATA_MISMATCH;")
+    lines.append("        }")
+    lines.append("    }")
+    lines.append("")
+    lines.append("    return status;")
+    lines.append("}")
+    lines.append("")
+
+def print_verify_file(soc, file_name, brief, includes, fxns, define=None):
+    lines = [LICENSE]
+    lines.append("/**")
+    lines.append(" *  \\file     " + file_name)
+    lines.append(" *")
+    lines.append(" *  \\brief    " + brief + " for " + soc + ".")
+    lines.append(" *            Generated by utils/safety_checkers_verify_gen.py from")
+    lines.append(" *            safety_checkers_soc.h, do not edit.")
+    lines.append(" *")
+    lines.append(" */")
+    lines.append("")
+    banner(lines, "Include Files")
+    if define is not None:
+        # The routine is declared by its header only in builds that opt in to it
+        lines.append("#if !defined (" + define + ")")
+        lines.append("#define " + define)
+        lines.append("#endif")
+        lines.append("")
+    for include in includes:
+        lines.append("#include <" + include + ">")
+    lines.append("")
+    banner(lines, "Function Definitions")
+    for fxn in fxns:
+        print_verify_fxn(lines, *fxn)
+    return "\n".join(lines)
+
+def update_file(file_name, text, check_only):
+    old_text = None
+    if os.path.isfile(file_name):
+        with open(file_name, "r") as input_file:
+            old_text = input_file.read()
+
+    if text == old_text:
+        return 0
+    if check_only:
+        print(file_name + ": unrolled verify routines are out of date")
+        return 1
+    with open(file_name, "w") as output_file:
+        output_file.write(text)
+    print(file_name + ": generated")
+    return 0
+
+def generate_soc(soc_dir, soc, pll_offsets, stride_text, with_rm, check_only):
+    with open(os.path.join(soc_dir, soc, SOC_FILE), "r") as input_file:
+        soc_text = input_file.read()
+
+    pll_regs, _, psc_regs = build_tables(soc_text, pll_offsets)
+    text = print_verify_file(soc, VERIFY_FILE, "Unrolled PM register verify routines",
+                             ["stdint.h", "cslr.h", "safety_checkers_pm.h", "safety_checkers_common.h",
+                              "safety_checkers_soc.h"],
+                             [("SafetyCheckers_pmVerifyPscRegCfgUnrolled", "pscRegCfg",
+                               "SAFETY_CHECKERS_PM_PSC_FLAT_NUM", psc_regs, "PSC"),
+                              ("SafetyCheckers_pmVerifyPllRegCfgUnrolled", "pllRegCfg",
+                               "SAFETY_CHECKERS_PM_PLL_FLAT_NUM", pll_regs, "PLL")])
+    errors = update_file(os.path.join(soc_dir, soc, VERIFY_FILE), text, check_only)
+
+    if with_rm:
+        rm_regs = build_rm_regs(soc_text, stride_text)
+        text = print_verify_file(soc, VERIFY_RM_FILE, "Unrolled RM register verify routine",
+                                 ["stdint.h", "cslr.h", "safety_checkers_rm.h", "safety_checkers_common.h",
+                                  "safety_checkers_soc.h"],
+                                 [("SafetyCheckers_rmVerifyRegCfgUnrolled", "rmRegCfg",
+                                   "SAFETY_CHECKERS_RM_REGDUMP_SIZE", rm_regs, "Module")],
+                                 "SAFETY_CHECKERS_RM_VERIFY_UNROLLED")
+        errors += update_file(os.path.join(soc_dir, soc, VERIFY_RM_FILE), text, check_only)
+
+    return errors
+
+
+############################ Main ############################
+
+def main(argv):
+    parser = argparse.ArgumentParser(description="Generate the unrolled PM/RM verify routines of each SoC")
+    parser.add_argument("soc_dir", help="src/soc directory holding the common SoC headers and one directory per SoC")
+    parser.add_argument("--check", action="store_true", help="Only report the SoCs whose unrolled verify routines are out of date")
+    parser.add_argument("--rm", action="store_true", help="Also generate the unrolled RM verify routine (" + VERIFY_RM_FILE + ")")
+    args = parser.parse_args(argv)
+
+    with open(os.path.join(args.soc_dir, PLL_OFFSET_FILE), "r") as input_file:
+        pll_offsets = parse_pll_offsets(input_file.read())
+    with open(os.path.join(args.soc_dir, RM_STRIDE_FILE), "r") as input_file:
+        stride_text = input_file.read()
+
+    errors = 0
+    for soc in sorted(os.listdir(args.soc_dir)):
+        if os.path.isfile(os.path.join(args.soc_dir, soc, SOC_FILE)):
+            errors += generate_soc(args.soc_dir, soc, pll_offsets, stride_text, args.rm, args.check)
+    exit(1 if errors != 0 else 0)
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
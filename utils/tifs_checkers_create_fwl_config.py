@@ -97,7 +97,14 @@ def print_fwl_data(output_filename, fwl_dict):
         output_file.write("/* ========================================================================== */\n")
         output_file.write("/*                           Macros & Typedefs                                */\n")
         output_file.write("/* ========================================================================== */\n\n")
-        output_file.write("/* None */\n\n")
+        # Regions of each firewall are packed back to back in one shared region array
+        num_regions = 0
+        for keys in fwl_dict:
+            fwl_dict[keys]["region_offset"] = num_regions
+            num_regions += int(fwl_dict[keys]["max_num_regions"][:-1])
+
+        output_file.write("/* Number of regions of the shared firewall region array */\n")
+        output_file.write("#define TIFS_CHECKER_FWL_REGION_NUM                               (" + str(num_regions) + "U)\n\n")
         output_file.write("/* ========================================================================== */\n")
         output_file.write("/*                         Structure Declarations                             */\n")
         output_file.write("/* ========================================================================== */\n\n")
@@ -106,35 +113,27 @@ def print_fwl_data(output_filename, fwl_dict):
         output_file.write("/*                            Global Variables                                */\n")
         output_file.write("/* ========================================================================== */\n\n")
 
-        output_file.write("/* Static firewall configuration to be populated with register values */ \n")
-        output_file.write("SafetyCheckers_TifsFwlConfig gSafetyCheckers_TifsFwlConfig[TIFS_CHECKER_FWL_MAX_NUM] = {\n")
-
-        # Iterating over the keys in the dictionary and writing to file along with necessary comments
+        # Write the firewall directory, one entry per firewall
+        output_file.write("/* Firewall directory : {fwlId, regionOffset, numRegions, maxNumRegions} */\n")
+        output_file.write("SafetyCheckers_TifsFwlDirEntry gSafetyCheckers_TifsFwlDir[TIFS_CHECKER_FWL_MAX_NUM] = {\n")
+        entries = []
         for keys in fwl_dict:
-            output_file.write("{\n")
-            for key,value in fwl_dict[keys].items():
-                if key == "fwl_id":
-                    output_file.write("\t" + value + "," + "\t/* fwlId */" + "\n")
-                elif key == "num_regions":
-                    output_file.write("\t" + value + "," + "\t/* numRegions */" + "\n")
-                elif key == "max_num_regions":
-                    output_file.write("\t" + value + "," + "\t/* maxNumRegions */" + "\n")
-                elif type(value) is list:
-                    output_file.write("\t{ \t/* Firewall registers for a given region : {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */\n")
-                    n = int(fwl_dict[keys]["num_regions"][:-1])
-                    for i in range(n):
-                        output_file.write("\t\t{")
-                        for ele in value:
-                            output_file.write("0x0U, ")
-                        output_file.seek(output_file.tell()-2)
-                        output_file.truncate()
-                        output_file.write("},\n")
-                    output_file.write("\t},\n")
-            output_file.write("},\n")
-        output_file.seek(output_file.tell()-2)
-        output_file.truncate()
-        output_file.write("\n};")
-
+            entries.append("\t{" + fwl_dict[keys]["fwl_id"] + ", " + str(fwl_dict[keys]["region_offset"]) + "U, " +
+                           fwl_dict[keys]["num_regions"] + ", " + fwl_dict[keys]["max_num_regions"] + "}")
+        output_file.write(",\n".join(entries))
+        output_file.write("\n};\n\n")
+
+        # Write the shared region array and the packed configuration using it
+        output_file.write("/* Firewall registers of every region to be populated with register values :\n")
+        output_file.write(" * {controlReg, privId0, privId1, privId2, startAddrLow, startAddrHigh, endAddrLow, endAddrHigh} */\n")
+        output_file.write("SafetyCheckers_TifsFwlRegList gSafetyCheckers_TifsFwlRegions[TIFS_CHECKER_FWL_REGION_NUM];\n\n")
+        output_file.write("/* Packed firewall configuration */\n")
+        output_file.write("SafetyCheckers_TifsFwlPackedConfig gSafetyCheckers_TifsFwlPackedConfig = {\n")
+        output_file.write("\tgSafetyCheckers_TifsFwlDir,\t/* fwlDir */\n")
+        output_file.write("\tTIFS_CHECKER_FWL_MAX_NUM,\t/* numFwl */\n")
+        output_file.write("\tgSafetyCheckers_TifsFwlRegions,\t/* fwlRegions */\n")
+        output_file.write("\tTIFS_CHECKER_FWL_REGION_NUM\t/* numRegions */\n")
+        output_file.write("};")
         output_file.write("\n\n#ifdef __cplusplus\n")
         output_file.write("}\n")
         output_file.write("#endif\n\n")